@@ -0,0 +1,34 @@
+#include "benchmarkUtils.h"
+
+#include <cpp_sc/secure_encoding.h>
+#include <cpp_sc/secure_random.h>
+
+// Hex and base64 conversions of a short key and of a large buffer, including
+// the allocation of the result.
+int main()
+{
+    auto nothing = [] {};
+
+    std::cout << std::setw(10) << "size" << std::setw(12) << "hex enc" << std::setw(12) << "hex dec"
+              << std::setw(12) << "b64 enc" << std::setw(12) << "b64 dec" << "  (ns per byte)" << std::endl;
+    for (size_t size : { 32, 4096, 1024 * 1024 }) {
+        auto bytes = secure_random::generate<vector_secure<uint8_t>>(size);
+        string_secure hex = hex_encode(bytes);
+        string_secure base64 = base64_encode(bytes);
+        size_t rounds = 64u * 1024 * 1024 / size / 16 + 1;
+        volatile size_t sink = 0;
+
+        double times[4] = {
+            bestOf(5, nothing, [&] { for (size_t i = 0; i < rounds; ++i) sink = hex_encode(bytes).size(); }),
+            bestOf(5, nothing, [&] { for (size_t i = 0; i < rounds; ++i) sink = hex_decode(hex).size(); }),
+            bestOf(5, nothing, [&] { for (size_t i = 0; i < rounds; ++i) sink = base64_encode(bytes).size(); }),
+            bestOf(5, nothing, [&] { for (size_t i = 0; i < rounds; ++i) sink = base64_decode(base64).size(); }),
+        };
+
+        std::cout << std::setw(10) << formatSize(size) << std::fixed << std::setprecision(2);
+        for (double time : times)
+            std::cout << std::setw(12) << time / double(rounds * size);
+        std::cout << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include "benchmarkUtils.h"
+
+#include <cstring>
+#include <vector>
+
+#include <platform.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#endif
+
+static const char* instructionName(cache_flush_instruction instruction)
+{
+    switch (instruction) {
+    case cache_flush_instruction::clflush: return "clflush";
+    case cache_flush_instruction::clflushopt: return "clflushopt";
+    case cache_flush_instruction::clwb: return "clwb";
+    default: return "none";
+    }
+}
+
+// The workaround this replaces: burn(), then one clflush and fence per line.
+static void burnThenFlushEachLine(unsigned char* ptr, size_t size)
+{
+    burn(ptr, size);
+#if defined(__x86_64__) || defined(__i386__)
+    for (size_t offset = 0; offset < size; offset += 64) {
+        _mm_clflush(ptr + offset);
+        _mm_mfence();
+    }
+#endif
+}
+
+// Cost of evicting wiped buffers compared with a plain burn().
+int main()
+{
+    std::cout << "evict: " << instructionName(cache_evict_instruction())
+              << ", write back: " << instructionName(cache_write_back_instruction()) << std::endl
+              << std::setw(10) << "size"
+              << std::setw(12) << "burn, us"
+              << std::setw(14) << "per line, us"
+              << std::setw(14) << "evict, us"
+              << std::setw(16) << "write back, us" << std::endl;
+
+    for (size_t size = 4096; size <= 64u * 1024 * 1024; size *= 4) {
+        std::vector<unsigned char> buffer(size);
+        auto touch = [&] { std::memset(buffer.data(), 0xa5, size); };
+        size_t repeats = size >= 16u * 1024 * 1024 ? 5 : 50;
+
+        double burnTime = bestOf(repeats, touch, [&] { burn(buffer.data(), size); });
+        double perLineTime = bestOf(repeats, touch, [&] { burnThenFlushEachLine(buffer.data(), size); });
+        double evictTime = bestOf(repeats, touch, [&] { burn_and_flush(buffer.data(), size); });
+        double writeBackTime = bestOf(repeats, touch, [&] {
+            burn(buffer.data(), size);
+            write_back_cache(buffer.data(), size);
+        });
+
+        std::cout << std::setw(10) << formatSize(size) << std::fixed << std::setprecision(1)
+                  << std::setw(12) << burnTime / 1000.0
+                  << std::setw(14) << perLineTime / 1000.0
+                  << std::setw(14) << evictTime / 1000.0
+                  << std::setw(16) << writeBackTime / 1000.0 << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,42 @@
+#include "benchmarkUtils.h"
+
+#include <string_view>
+
+#include <cpp_sc/basic_string_secure.h>
+
+// Building a response from 64-byte fragments, with the standard doubling and
+// with learned_growth (which has seen one response before), us per 100
+// responses.
+int main()
+{
+    constexpr size_t ROUNDS = 100;
+    constexpr std::string_view FRAGMENT = "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef";
+    auto nothing = [] {};
+
+    std::cout << std::setw(10) << "size" << std::setw(16) << "standard"
+              << std::setw(16) << "learned" << std::setw(10) << "ratio" << std::endl;
+    for (size_t size : { 1024, 4096, 65536, 1 << 20 }) {
+        using learned = learned_growth<struct benchmark_tag>;
+        learned::reset();
+
+        auto build = [size, FRAGMENT]<typename Growth>(Growth) {
+            basic_string_secure<char, sanitizing_allocator<char>, Growth> response;
+            for (size_t i = 0; i < size; i += FRAGMENT.size())
+                response += FRAGMENT;
+            return response[size / 2];
+        };
+        volatile char sink = 0;
+
+        double standardTime = bestOf(5, nothing, [&] {
+            for (size_t i = 0; i < ROUNDS; ++i)
+                sink = build(standard_growth{});
+        });
+        double learnedTime = bestOf(5, nothing, [&] {
+            for (size_t i = 0; i < ROUNDS; ++i)
+                sink = build(learned{});
+        });
+
+        printRow(formatSize(size), standardTime, learnedTime);
+    }
+    return 0;
+}
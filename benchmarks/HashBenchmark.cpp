@@ -0,0 +1,34 @@
+#include "benchmarkUtils.h"
+
+#include <functional>
+#include <string>
+
+#include <cpp_sc/secure_hash.h>
+
+// secure_hash against the unkeyed std::hash of the same string, ns per hash.
+int main()
+{
+    constexpr size_t ROUNDS = 1000000;
+    auto nothing = [] {};
+
+    std::cout << std::setw(10) << "size" << std::setw(16) << "std::hash"
+              << std::setw(16) << "secure_hash" << std::endl;
+    for (size_t size : { 8, 16, 32, 64, 256 }) {
+        string_secure key(size, 'k');
+        std::string plain(size, 'k');
+        volatile size_t sink = 0;
+
+        double stdTime = bestOf(5, nothing, [&] {
+            for (size_t i = 0; i < ROUNDS; ++i)
+                sink = std::hash<std::string>()(plain);
+        });
+        double secureTime = bestOf(5, nothing, [&] {
+            for (size_t i = 0; i < ROUNDS; ++i)
+                sink = secure_hash<string_secure>()(key);
+        });
+
+        std::cout << std::setw(10) << formatSize(size) << std::setw(16) << std::fixed << std::setprecision(1)
+                  << stdTime / ROUNDS << std::setw(16) << secureTime / ROUNDS << std::endl;
+    }
+    return 0;
+}
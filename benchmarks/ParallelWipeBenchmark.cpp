@@ -0,0 +1,32 @@
+#include "benchmarkUtils.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <platform.h>
+#include <parallel_burn.h>
+
+// burn() against parallel_burn() on large resident buffers. The speedup is
+// bounded by the number of cores and by memory bandwidth.
+int main()
+{
+    std::cout << "workers: " << parallel_wipe_workers()
+              << " (" << std::thread::hardware_concurrency() << " cores)" << std::endl
+              << std::setw(10) << "size"
+              << std::setw(16) << "burn, us"
+              << std::setw(16) << "parallel, us"
+              << std::setw(10) << "speedup" << std::endl;
+
+    set_parallel_wipe_threshold(0);
+    for (size_t size = 4u * 1024 * 1024; size <= 1024u * 1024 * 1024; size *= 4) {
+        std::vector<unsigned char> buffer(size);
+        auto touch = [&] { std::memset(buffer.data(), 0xa5, size); };
+
+        double burnTime = bestOf(5, touch, [&] { burn(buffer.data(), size); });
+        double parallelTime = bestOf(5, touch, [&] { parallel_burn(buffer.data(), size); });
+
+        printRow(formatSize(size), burnTime, parallelTime);
+    }
+    return 0;
+}
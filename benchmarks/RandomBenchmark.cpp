@@ -0,0 +1,43 @@
+#include "benchmarkUtils.h"
+
+#include <vector>
+
+#include <platform.h>
+#include <cpp_sc/secure_random.h>
+#include <cpp_sc/vector_secure.h>
+
+// secure_random against one OS entropy call per key, and its bulk throughput.
+int main()
+{
+    constexpr size_t KEYS = 10000;
+    auto nothing = [] {};
+
+    vector_secure<uint8_t> key;
+    key.resize(32);
+    double syscallTime = bestOf(5, nothing, [&] {
+        for (size_t i = 0; i < KEYS; ++i)
+            system_random(key.data(), key.size());
+    });
+    double drbgTime = bestOf(5, nothing, [&] {
+        for (size_t i = 0; i < KEYS; ++i)
+            secure_random::fill(key);
+    });
+
+    std::cout << "32-byte keys, ns per key" << std::endl
+              << std::setw(10) << "" << std::setw(16) << "system_random"
+              << std::setw(16) << "secure_random" << std::setw(10) << "speedup" << std::endl;
+    printRow("", syscallTime / KEYS * 1000.0, drbgTime / KEYS * 1000.0);
+
+    std::cout << std::endl << std::setw(10) << "size" << std::setw(16) << "GB/s" << std::endl;
+    for (size_t size = 4096; size <= 64u * 1024 * 1024; size *= 16) {
+        std::vector<uint8_t> buffer(size);
+        size_t rounds = 256u * 1024 * 1024 / size;
+        double time = bestOf(3, nothing, [&] {
+            for (size_t i = 0; i < rounds; ++i)
+                secure_random::fill(buffer);
+        });
+        std::cout << std::setw(10) << formatSize(size) << std::setw(16) << std::fixed << std::setprecision(2)
+                  << double(size * rounds) / time << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include "benchmarkUtils.h"
+
+#include <utility>
+
+#include <cpp_sc/sealed_secure.h>
+#include <cpp_sc/secure_random.h>
+#include <cpp_sc/vector_secure.h>
+
+// Cost of one scoped unseal of a sealed key: read-only, and read-write with
+// resealing on exit.
+int main()
+{
+    constexpr size_t ROUNDS = 100000;
+    auto nothing = [] {};
+
+    std::cout << std::setw(10) << "size" << std::setw(16) << "read, ns"
+              << std::setw(16) << "modify, ns" << std::endl;
+    for (size_t size : { 32, 256, 4096 }) {
+        sealed_secure<vector_secure<uint8_t>> sealed(secure_random::generate<vector_secure<uint8_t>>(size));
+        volatile uint8_t sink = 0;
+
+        double readTime = bestOf(5, nothing, [&] {
+            for (size_t i = 0; i < ROUNDS; ++i)
+                sink = (*std::as_const(sealed).unseal())[0];
+        });
+        double modifyTime = bestOf(5, nothing, [&] {
+            for (size_t i = 0; i < ROUNDS; ++i)
+                (*sealed.unseal())[0] ^= 1;
+        });
+
+        std::cout << std::setw(10) << formatSize(size) << std::setw(16) << std::fixed << std::setprecision(1)
+                  << readTime / ROUNDS << std::setw(16) << modifyTime / ROUNDS << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include "benchmarkUtils.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+#include <cpp_sc/secret_table.h>
+#include <cpp_sc/vector_secure.h>
+
+// A million 32-byte keys as vector_secure<vector_secure<uint8_t>> and as a
+// secret_table<32>, us to fill and to destroy, and the constant-time find
+// over the whole table.
+int main()
+{
+    constexpr size_t KEYS = 1000000;
+    constexpr size_t WIDTH = 32;
+    using nested = vector_secure<vector_secure<uint8_t>>;
+    using table = secret_table<WIDTH>;
+
+    std::array<uint8_t, WIDTH> key{};
+    auto nothing = [] {};
+    std::unique_ptr<nested> keys;
+    std::unique_ptr<table> slots;
+
+    auto fillNested = [&] {
+        keys = std::make_unique<nested>();
+        keys->reserve(KEYS);
+        for (size_t i = 0; i < KEYS; ++i) {
+            key[0] = uint8_t(i);
+            keys->push_back(nested::value_type::copy(key.begin(), key.end()));
+        }
+    };
+    auto fillTable = [&] {
+        slots = std::make_unique<table>(KEYS);
+        for (size_t i = 0; i < KEYS; ++i) {
+            key[0] = uint8_t(i);
+            slots->insert(key);
+        }
+    };
+
+    std::cout << std::setw(10) << "" << std::setw(16) << "nested"
+              << std::setw(16) << "secret_table" << std::setw(10) << "ratio" << std::endl;
+    printRow("fill", bestOf(3, [&] { keys.reset(); }, fillNested), bestOf(3, [&] { slots.reset(); }, fillTable));
+    printRow("destroy", bestOf(3, fillNested, [&] { keys.reset(); }), bestOf(3, fillTable, [&] { slots.reset(); }));
+
+    fillTable();
+    key.fill(0xff);
+    volatile bool sink = false;
+    double findTime = bestOf(5, nothing, [&] { sink = slots->find(key).has_value(); });
+    std::cout << "find: " << std::fixed << std::setprecision(2) << findTime / KEYS << " ns per slot, "
+              << (slots->capacity() * (WIDTH + 2 * sizeof(uint32_t))) / KEYS << " bytes per key" << std::endl;
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include "benchmarkUtils.h"
+
+#include <cstdint>
+
+#include <cpp_sc/scoped_stack_scrub.h>
+
+// Stands in for a crypto routine that uses Size bytes of stack
+template <size_t Size>
+__attribute__((noinline)) static void useStack()
+{
+    static volatile uint8_t sink;
+    volatile uint8_t frame[Size];
+    for (size_t i = 0; i < Size; i += 64)
+        frame[i] = uint8_t(i);
+    sink = frame[0];
+    (void)sink;
+}
+
+template <size_t Size>
+static void compare(size_t depth)
+{
+    auto nothing = [] {};
+    double fixedTime = bestOf(20, nothing, [depth] {
+        for (int i = 0; i < 1000; ++i) {
+            useStack<Size>();
+            burn_stack(depth);
+        }
+    });
+    double scopedTime = bestOf(20, nothing, [depth] {
+        for (int i = 0; i < 1000; ++i) {
+            scoped_stack_scrub scrub(depth);
+            useStack<Size>();
+        }
+    });
+
+    // Both columns are per call, in nanoseconds
+    std::cout << std::setw(10) << formatSize(depth)
+              << std::setw(10) << formatSize(Size) << std::fixed << std::setprecision(1)
+              << std::setw(16) << fixedTime / 1000.0
+              << std::setw(16) << scopedTime / 1000.0
+              << std::setw(10) << std::setprecision(2) << fixedTime / scopedTime << std::endl;
+}
+
+// A fixed scrub of the whole scrub depth after every call against
+// scoped_stack_scrub, which only wipes the depth the call reached.
+int main()
+{
+    std::cout << std::setw(10) << "depth"
+              << std::setw(10) << "used"
+              << std::setw(16) << "fixed, ns"
+              << std::setw(16) << "scoped, ns"
+              << std::setw(10) << "speedup" << std::endl;
+
+    for (size_t depth : { STACK_SCRUB_DEPTH, 4 * STACK_SCRUB_DEPTH, 16 * STACK_SCRUB_DEPTH }) {
+        compare<256>(depth);
+        compare<1024>(depth);
+        compare<4096>(depth);
+        compare<12 * 1024>(depth);
+    }
+    return 0;
+}
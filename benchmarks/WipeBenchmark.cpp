@@ -0,0 +1,73 @@
+#include "benchmarkUtils.h"
+
+#include <cstring>
+
+#include <platform.h>
+#include <cpp_sc/page_allocator.h>
+
+// Wiping a resident page-aligned mapping: burn() against discard_pages().
+// Shows the buffer size where dropping the pages starts to win.
+static int compareWipe()
+{
+    std::cout << std::setw(10) << "size"
+              << std::setw(16) << "burn, us"
+              << std::setw(16) << "discard, us"
+              << std::setw(10) << "speedup" << std::endl;
+
+    for (size_t size = 16 * 1024; size <= 256u * 1024 * 1024; size *= 4) {
+        auto* buffer = static_cast<unsigned char*>(map_pages(size));
+        if (!buffer) {
+            std::cerr << "map_pages failed for " << formatSize(size) << std::endl;
+            return 1;
+        }
+
+        size_t repeats = size >= 64u * 1024 * 1024 ? 3 : 20;
+        auto touch = [&] { std::memset(buffer, 0xa5, size); };
+
+        double burnTime = bestOf(repeats, touch, [&] { burn(buffer, size); });
+        double discardTime = bestOf(repeats, touch, [&] {
+            if (!discard_pages(buffer, size))
+                burn(buffer, size);
+        });
+
+        printRow(formatSize(size), burnTime, discardTime);
+        unmap_pages(buffer, size);
+    }
+    return 0;
+}
+
+// Whole lifetime of a buffer (allocate, fill, wipe and release) with the
+// default sanitizing_allocator against paged_sanitizing_allocator.
+static void compareLifetime()
+{
+    std::cout << std::endl
+              << std::setw(10) << "size"
+              << std::setw(16) << "default, us"
+              << std::setw(16) << "paged, us"
+              << std::setw(10) << "speedup" << std::endl;
+
+    auto lifetime = [](auto alloc, size_t size) {
+        char* p = alloc.allocate(size);
+        std::memset(p, 0xa5, size);
+        alloc.deallocate(p, size);
+    };
+
+    for (size_t size = 256 * 1024; size <= 256u * 1024 * 1024; size *= 4) {
+        size_t repeats = size >= 64u * 1024 * 1024 ? 3 : 20;
+        auto nothing = [] {};
+
+        double defaultTime = bestOf(repeats, nothing, [&] { lifetime(sanitizing_allocator<char>(), size); });
+        double pagedTime = bestOf(repeats, nothing, [&] { lifetime(paged_sanitizing_allocator<char>(), size); });
+
+        printRow(formatSize(size), defaultTime, pagedTime);
+    }
+}
+
+int main()
+{
+    if (int rc = compareWipe())
+        return rc;
+
+    compareLifetime();
+    return 0;
+}
@@ -0,0 +1,46 @@
+#ifndef BENCHMARK_UTILS_H
+#define BENCHMARK_UTILS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/**
+ * Runs \p prepare (untimed) and \p body (timed) \p repeats times and returns the
+ * best time of \p body in nanoseconds.
+ */
+template <typename Prepare, typename Body>
+double bestOf(size_t repeats, Prepare&& prepare, Body&& body)
+{
+    double best = 1e300;
+    for (size_t i = 0; i < repeats; ++i) {
+        prepare();
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+    }
+    return best;
+}
+
+inline std::string formatSize(size_t bytes)
+{
+    if (bytes >= (1u << 20))
+        return std::to_string(bytes >> 20) + " MiB";
+    if (bytes >= (1u << 10))
+        return std::to_string(bytes >> 10) + " KiB";
+    return std::to_string(bytes) + " B";
+}
+
+inline void printRow(const std::string& label, double first, double second)
+{
+    std::cout << std::setw(10) << label
+              << std::setw(16) << std::fixed << std::setprecision(1) << first / 1000.0
+              << std::setw(16) << second / 1000.0
+              << std::setw(10) << std::setprecision(2) << first / second << std::endl;
+}
+
+#endif // BENCHMARK_UTILS_H
@@ -0,0 +1,94 @@
+#include "block_pool.h"
+
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace {
+
+constexpr size_t SIZE_CLASSES = POOL_MAX_BLOCK_SIZE / POOL_BLOCK_ALIGNMENT;
+constexpr size_t BLOCKS_PER_CHUNK = 64;
+
+struct free_block {
+    free_block* next;
+    bool zeroed;
+};
+
+struct size_class {
+    std::mutex mutex;
+    free_block* head = nullptr;
+};
+
+size_class& classFor(size_t bytes) noexcept
+{
+    static size_class classes[SIZE_CLASSES];
+    return classes[(bytes - 1) / POOL_BLOCK_ALIGNMENT];
+}
+
+size_t blockSizeFor(size_t bytes) noexcept
+{
+    return (bytes + POOL_BLOCK_ALIGNMENT - 1) / POOL_BLOCK_ALIGNMENT * POOL_BLOCK_ALIGNMENT;
+}
+
+// Chunks are never returned to the system: the pool lives as long as the process.
+void refill(size_class& sc, size_t blockSize)
+{
+    auto* chunk = static_cast<unsigned char*>(
+            ::operator new(blockSize * BLOCKS_PER_CHUNK, std::align_val_t(POOL_BLOCK_ALIGNMENT)));
+    std::memset(chunk, 0, blockSize * BLOCKS_PER_CHUNK);
+
+    for (size_t i = 0; i < BLOCKS_PER_CHUNK; ++i) {
+        auto* block = reinterpret_cast<free_block*>(chunk + i * blockSize);
+        block->next = sc.head;
+        block->zeroed = true;
+        sc.head = block;
+    }
+}
+
+void release(void* ptr, size_t bytes, bool zeroed) noexcept
+{
+    if (bytes == 0)
+        bytes = 1;
+
+    size_class& sc = classFor(bytes);
+    std::lock_guard lock(sc.mutex);
+
+    auto* block = static_cast<free_block*>(ptr);
+    block->next = sc.head;
+    block->zeroed = zeroed;
+    sc.head = block;
+}
+
+} // namespace
+
+void* pool_allocate(size_t bytes)
+{
+    if (bytes == 0)
+        bytes = 1;
+
+    size_t blockSize = blockSizeFor(bytes);
+    size_class& sc = classFor(bytes);
+    free_block* block;
+    {
+        std::lock_guard lock(sc.mutex);
+
+        if (!sc.head)
+            refill(sc, blockSize);
+
+        block = sc.head;
+        sc.head = block->next;
+    }
+
+    std::memset(block, 0, block->zeroed ? sizeof(free_block) : blockSize);
+    return block;
+}
+
+void pool_deallocate(void* ptr, size_t bytes) noexcept
+{
+    release(ptr, bytes, false);
+}
+
+void pool_deallocate_zeroed(void* ptr, size_t bytes) noexcept
+{
+    release(ptr, bytes, true);
+}
@@ -0,0 +1,24 @@
+#ifndef BLOCK_POOL_H
+#define BLOCK_POOL_H
+
+#include <cstddef>
+
+constexpr size_t POOL_BLOCK_ALIGNMENT = 16;
+constexpr size_t POOL_MAX_BLOCK_SIZE = 256;
+
+/**
+ * Fixed-size block pool for small allocations. Requests are rounded up to a
+ * multiple of POOL_BLOCK_ALIGNMENT and served from per-size free lists, so
+ * allocation and deallocation never reach the system allocator once a size
+ * class is warmed up. Blocks are not wiped here; that is done by the
+ * sanitizing layer on top.
+ *
+ * pool_allocate always returns a zero-filled block. Blocks released with
+ * pool_deallocate_zeroed are known to be zero already and are handed out again
+ * without clearing; other blocks are cleared when they are reused.
+ */
+void* pool_allocate(size_t bytes);
+void pool_deallocate(void* ptr, size_t bytes) noexcept;
+void pool_deallocate_zeroed(void* ptr, size_t bytes) noexcept;
+
+#endif // BLOCK_POOL_H
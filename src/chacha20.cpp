@@ -0,0 +1,263 @@
+#include "chacha20.h"
+#include "platform.h"
+#include "vector_extensions.h"
+
+#include <cstring>
+
+namespace {
+
+#if defined(__VECTOR_EXTENSIONS__)
+constexpr size_t LANES = 8;
+typedef uint32_t lanes_t __attribute__((vector_size(LANES * sizeof(uint32_t))));
+
+__ALWAYS_INLINE uint32_t lane(const lanes_t& v, size_t i) noexcept
+{
+    return v[i];
+}
+#else
+constexpr size_t LANES = 1;
+typedef uint32_t lanes_t;
+
+uint32_t lane(lanes_t v, size_t) noexcept
+{
+    return v;
+}
+#endif
+
+constexpr size_t BATCH_SIZE = LANES * CHACHA20_BLOCK_SIZE;
+
+uint32_t load32(const uint8_t* p) noexcept
+{
+    return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24;
+}
+
+__ALWAYS_INLINE void store32(uint8_t* p, uint32_t v) noexcept
+{
+    p[0] = uint8_t(v);
+    p[1] = uint8_t(v >> 8);
+    p[2] = uint8_t(v >> 16);
+    p[3] = uint8_t(v >> 24);
+}
+
+// Vectors are only passed by reference: by value they would change the ABI
+// between the AVX2 and default clones.
+template <int N, typename V>
+__ALWAYS_INLINE void rotl(V& v) noexcept
+{
+    v = (v << N) | (v >> (32 - N));
+}
+
+template <typename V>
+__ALWAYS_INLINE void quarterRound(V& a, V& b, V& c, V& d) noexcept
+{
+    a += b; d ^= a; rotl<16>(d);
+    c += d; b ^= c; rotl<12>(b);
+    a += b; d ^= a; rotl<8>(d);
+    c += d; b ^= c; rotl<7>(b);
+}
+
+#if defined(__VECTOR_EXTENSIONS__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+// 8x8 transpose by three rounds of zipping row i with row i + 4; afterwards
+// row j holds lane j of every input row.
+__ALWAYS_INLINE void transpose(lanes_t* rows) noexcept
+{
+    for (int round = 0; round < 3; ++round) {
+        lanes_t zipped[8];
+        for (int i = 0; i < 4; ++i) {
+            zipped[2 * i] = __builtin_shufflevector(rows[i], rows[i + 4], 0, 8, 1, 9, 2, 10, 3, 11);
+            zipped[2 * i + 1] = __builtin_shufflevector(rows[i], rows[i + 4], 4, 12, 5, 13, 6, 14, 7, 15);
+        }
+        for (int i = 0; i < 8; ++i)
+            rows[i] = zipped[i];
+    }
+}
+
+__ALWAYS_INLINE void storeBlocks(lanes_t* x, uint8_t* out) noexcept
+{
+    transpose(x);
+    transpose(x + 8);
+    for (size_t block = 0; block < LANES; ++block) {
+        std::memcpy(out + block * CHACHA20_BLOCK_SIZE, &x[block], sizeof(lanes_t));
+        std::memcpy(out + block * CHACHA20_BLOCK_SIZE + sizeof(lanes_t), &x[8 + block], sizeof(lanes_t));
+    }
+}
+#else
+__ALWAYS_INLINE void storeBlocks(lanes_t* x, uint8_t* out) noexcept
+{
+    for (size_t block = 0; block < LANES; ++block)
+        for (size_t i = 0; i < 16; ++i)
+            store32(out + block * CHACHA20_BLOCK_SIZE + i * 4, lane(x[i], block));
+}
+#endif
+
+// Computes LANES consecutive blocks; lane i holds block counter + i.
+__VECTOR_CLONES void batch(const uint32_t input[16], uint8_t out[BATCH_SIZE]) noexcept
+{
+#if defined(__VECTOR_EXTENSIONS__)
+    const lanes_t counters = lanes_t{ 0, 1, 2, 3, 4, 5, 6, 7 } + input[12];
+#else
+    const lanes_t counters = input[12];
+#endif
+
+    lanes_t x[16];
+    for (size_t i = 0; i < 16; ++i)
+        x[i] = lanes_t{} + input[i];
+    x[12] = counters;
+
+    for (int round = 0; round < 10; ++round) {
+        quarterRound(x[0], x[4], x[8], x[12]);
+        quarterRound(x[1], x[5], x[9], x[13]);
+        quarterRound(x[2], x[6], x[10], x[14]);
+        quarterRound(x[3], x[7], x[11], x[15]);
+        quarterRound(x[0], x[5], x[10], x[15]);
+        quarterRound(x[1], x[6], x[11], x[12]);
+        quarterRound(x[2], x[7], x[8], x[13]);
+        quarterRound(x[3], x[4], x[9], x[14]);
+    }
+
+    // The input is broadcast again rather than kept in registers
+    for (size_t i = 0; i < 16; ++i)
+        x[i] += i == 12 ? counters : lanes_t{} + input[i];
+
+    storeBlocks(x, out);
+}
+
+#if defined(__VECTOR_EXTENSIONS__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+typedef uint32_t row_t __attribute__((vector_size(4 * sizeof(uint32_t))));
+
+// One block with a row of the state per vector, for requests too short to
+// pay for a whole batch. Diagonal rounds rotate rows b, c and d into columns.
+void block(const uint32_t input[16], uint8_t out[CHACHA20_BLOCK_SIZE]) noexcept
+{
+    row_t rows[4];
+    std::memcpy(rows, input, sizeof(rows));
+    row_t a = rows[0], b = rows[1], c = rows[2], d = rows[3];
+
+    for (int round = 0; round < 10; ++round) {
+        quarterRound(a, b, c, d);
+        b = __builtin_shufflevector(b, b, 1, 2, 3, 0);
+        c = __builtin_shufflevector(c, c, 2, 3, 0, 1);
+        d = __builtin_shufflevector(d, d, 3, 0, 1, 2);
+        quarterRound(a, b, c, d);
+        b = __builtin_shufflevector(b, b, 3, 0, 1, 2);
+        c = __builtin_shufflevector(c, c, 2, 3, 0, 1);
+        d = __builtin_shufflevector(d, d, 1, 2, 3, 0);
+    }
+
+    rows[0] += a;
+    rows[1] += b;
+    rows[2] += c;
+    rows[3] += d;
+    std::memcpy(out, rows, sizeof(rows));
+}
+#else
+void block(const uint32_t input[16], uint8_t out[CHACHA20_BLOCK_SIZE]) noexcept
+{
+    uint32_t x[16];
+    std::memcpy(x, input, sizeof(x));
+
+    for (int round = 0; round < 10; ++round) {
+        quarterRound(x[0], x[4], x[8], x[12]);
+        quarterRound(x[1], x[5], x[9], x[13]);
+        quarterRound(x[2], x[6], x[10], x[14]);
+        quarterRound(x[3], x[7], x[11], x[15]);
+        quarterRound(x[0], x[5], x[10], x[15]);
+        quarterRound(x[1], x[6], x[11], x[12]);
+        quarterRound(x[2], x[7], x[8], x[13]);
+        quarterRound(x[3], x[4], x[9], x[14]);
+    }
+
+    for (size_t i = 0; i < 16; ++i)
+        store32(out + i * 4, x[i] + input[i]);
+    burn(x, sizeof(x));
+}
+#endif
+
+void setup(uint32_t state[16], const uint8_t* key, const uint8_t* nonce, uint32_t counter) noexcept
+{
+    state[0] = 0x61707865;
+    state[1] = 0x3320646e;
+    state[2] = 0x79622d32;
+    state[3] = 0x6b206574;
+    for (size_t i = 0; i < 8; ++i)
+        state[4 + i] = load32(key + i * 4);
+    state[12] = counter;
+    for (size_t i = 0; i < 3; ++i)
+        state[13 + i] = load32(nonce + i * 4);
+}
+
+// Key material spilled by batch() is left below the caller's frame; one
+// scrub per call is much cheaper than wiping the spills of every batch.
+// block() spills far less.
+constexpr size_t BATCH_STACK_DEPTH = 4096;
+constexpr size_t BLOCK_STACK_DEPTH = 512;
+
+// Up to this many bytes at the end are computed one block at a time
+constexpr size_t BLOCK_TAIL = 2 * CHACHA20_BLOCK_SIZE;
+
+} // namespace
+
+void chacha20_keystream(const uint8_t* key, const uint8_t* nonce, uint32_t counter,
+                        void* out, size_t size) noexcept
+{
+    uint32_t state[16];
+    setup(state, key, nonce, counter);
+    bool batched = size > BLOCK_TAIL;
+
+    auto* dst = static_cast<uint8_t*>(out);
+    for (; size >= BATCH_SIZE; dst += BATCH_SIZE, size -= BATCH_SIZE) {
+        batch(state, dst);
+        state[12] += uint32_t(LANES);
+    }
+
+    if (size > BLOCK_TAIL) {
+        alignas(64) uint8_t stream[BATCH_SIZE];
+        batch(state, stream);
+        std::memcpy(dst, stream, size);
+        burn(stream, sizeof(stream));
+    } else if (size) {
+        alignas(64) uint8_t stream[CHACHA20_BLOCK_SIZE];
+        for (; size >= CHACHA20_BLOCK_SIZE; dst += CHACHA20_BLOCK_SIZE, size -= CHACHA20_BLOCK_SIZE) {
+            block(state, dst);
+            ++state[12];
+        }
+        if (size) {
+            block(state, stream);
+            std::memcpy(dst, stream, size);
+        }
+        burn(stream, sizeof(stream));
+    }
+
+    burn(state, sizeof(state));
+    burn_stack(batched ? BATCH_STACK_DEPTH : BLOCK_STACK_DEPTH);
+}
+
+void chacha20_xor(const uint8_t* key, const uint8_t* nonce, uint32_t counter,
+                  void* data, size_t size) noexcept
+{
+    uint32_t state[16];
+    setup(state, key, nonce, counter);
+    bool batched = size > BLOCK_TAIL;
+
+    alignas(64) uint8_t stream[BATCH_SIZE];
+    for (auto* dst = static_cast<uint8_t*>(data); size;) {
+        size_t n;
+        if (size > BLOCK_TAIL) {
+            batch(state, stream);
+            n = size < BATCH_SIZE ? size : BATCH_SIZE;
+            state[12] += uint32_t(LANES);
+        } else {
+            block(state, stream);
+            n = size < CHACHA20_BLOCK_SIZE ? size : CHACHA20_BLOCK_SIZE;
+            ++state[12];
+        }
+        for (size_t i = 0; i < n; ++i)
+            dst[i] ^= stream[i];
+        dst += n;
+        size -= n;
+    }
+
+    burn(stream, batched ? sizeof(stream) : CHACHA20_BLOCK_SIZE);
+    burn(state, sizeof(state));
+    burn_stack(batched ? BATCH_STACK_DEPTH : BLOCK_STACK_DEPTH);
+}
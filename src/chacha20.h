@@ -0,0 +1,25 @@
+#ifndef CHACHA20_H
+#define CHACHA20_H
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr size_t CHACHA20_KEY_SIZE = 32;
+constexpr size_t CHACHA20_NONCE_SIZE = 12;
+constexpr size_t CHACHA20_BLOCK_SIZE = 64;
+
+/**
+ * ChaCha20 as specified in RFC 8439 (32-bit block counter, 96-bit nonce).
+ * chacha20_keystream writes \p size bytes of keystream starting at block
+ * \p counter; chacha20_xor encrypts or decrypts \p data in place. Blocks are
+ * computed eight at a time in vector registers (the AVX2 variant is picked at
+ * runtime where the compiler supports it); requests of up to two blocks, such
+ * as a sealed key, are computed one block at a time. No state is kept
+ * between calls and the keystream is never left in memory beyond the output.
+ */
+void chacha20_keystream(const uint8_t* key, const uint8_t* nonce, uint32_t counter,
+                        void* out, size_t size) noexcept;
+void chacha20_xor(const uint8_t* key, const uint8_t* nonce, uint32_t counter,
+                  void* data, size_t size) noexcept;
+
+#endif // CHACHA20_H
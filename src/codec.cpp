@@ -0,0 +1,271 @@
+#include "codec.h"
+#include "platform.h"
+#include "vector_extensions.h"
+
+#include <cstring>
+
+namespace {
+
+// -1 if lo <= c <= hi, 0 otherwise; c, lo and hi are in [0, 255]
+int inRange(int c, int lo, int hi) noexcept
+{
+    return ((lo - 1 - c) & (c - hi - 1)) >> 8;
+}
+
+char hexDigit(int nibble) noexcept
+{
+    return char(nibble + '0' + (inRange(nibble, 10, 15) & ('a' - '0' - 10)));
+}
+
+int hexValue(int c, int& invalid) noexcept
+{
+    int lower = c | 0x20;
+    int digit = inRange(c, '0', '9');
+    int letter = inRange(lower, 'a', 'f');
+
+    invalid |= ~(digit | letter);
+    return (digit & (c - '0')) | (letter & (lower - 'a' + 10));
+}
+
+char base64Digit(int sextet) noexcept
+{
+    return char(sextet + 'A'
+                + (inRange(sextet, 26, 63) & ('a' - 'A' - 26))
+                - (inRange(sextet, 52, 63) & ('a' - 26 - '0' + 52))
+                - (inRange(sextet, 62, 63) & ('0' - 52 - '+' + 62))
+                + (inRange(sextet, 63, 63) & ('/' - '+' - 1)));
+}
+
+int base64Value(int c, int& invalid) noexcept
+{
+    int upper = inRange(c, 'A', 'Z');
+    int lower = inRange(c, 'a', 'z');
+    int digit = inRange(c, '0', '9');
+    int plus = inRange(c, '+', '+');
+    int slash = inRange(c, '/', '/');
+
+    invalid |= ~(upper | lower | digit | plus | slash);
+    return (upper & (c - 'A')) | (lower & (c - 'a' + 26)) | (digit & (c - '0' + 52)) | (plus & 62) | (slash & 63);
+}
+
+#if defined(__VECTOR_EXTENSIONS__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+constexpr size_t VECTOR_SIZE = 32;
+typedef uint8_t bytes_t __attribute__((vector_size(VECTOR_SIZE)));
+typedef uint8_t half_bytes_t __attribute__((vector_size(VECTOR_SIZE / 2)));
+typedef uint16_t words_t __attribute__((vector_size(VECTOR_SIZE)));
+typedef uint32_t dwords_t __attribute__((vector_size(VECTOR_SIZE)));
+
+// Same masks as the scalar helper, a lane per character. A macro rather than
+// a function: vectors returned by value would change the ABI between the AVX2
+// and default clones.
+#define IN_RANGE(c, lo, hi) (bytes_t((c) >= (lo)) & bytes_t((c) <= (hi)))
+
+// Returns the number of input bytes encoded; the rest is left to the caller
+__VECTOR_CLONES size_t encodeHexVectors(const uint8_t* in, size_t size, char* out) noexcept
+{
+    size_t done = 0;
+    for (; size - done >= VECTOR_SIZE / 2; done += VECTOR_SIZE / 2) {
+        half_bytes_t b;
+        std::memcpy(&b, in + done, sizeof(b));
+
+        // high nibble in the low byte of each word, so it is written first
+        words_t w = __builtin_convertvector(b, words_t);
+        bytes_t nibbles = bytes_t((w >> 4) | ((w & 0xf) << 8));
+        bytes_t chars = nibbles + '0' + (IN_RANGE(nibbles, 10, 15) & ('a' - '0' - 10));
+
+        std::memcpy(out + 2 * done, &chars, sizeof(chars));
+    }
+    return done;
+}
+
+__VECTOR_CLONES size_t decodeHexVectors(const char* text, size_t size, uint8_t* out, int& invalid) noexcept
+{
+    bytes_t bad{};
+    size_t done = 0;
+    for (; size - done >= VECTOR_SIZE; done += VECTOR_SIZE) {
+        bytes_t c;
+        std::memcpy(&c, text + done, sizeof(c));
+
+        bytes_t lower = c | 0x20;
+        bytes_t digit = IN_RANGE(c, '0', '9');
+        bytes_t letter = IN_RANGE(lower, 'a', 'f');
+        bad |= ~(digit | letter);
+
+        words_t nibbles = words_t((digit & (c - '0')) | (letter & (lower - ('a' - 10))));
+        words_t bytes = ((nibbles & 0xff) << 4) | (nibbles >> 8);
+        half_bytes_t packed = __builtin_convertvector(bytes, half_bytes_t);
+
+        std::memcpy(out + done / 2, &packed, sizeof(packed));
+    }
+
+    for (size_t i = 0; i < VECTOR_SIZE; ++i)
+        invalid |= -int(bad[i] >> 7);
+    return done;
+}
+
+// Three input bytes per 32-bit lane, four characters out of each lane
+__VECTOR_CLONES size_t encodeBase64Vectors(const uint8_t* in, size_t size, char* out) noexcept
+{
+    constexpr size_t LANES = VECTOR_SIZE / 4;
+
+    size_t done = 0;
+    for (; size - done >= 3 * LANES; done += 3 * LANES) {
+        dwords_t v;
+        for (size_t i = 0; i < LANES; ++i) {
+            const uint8_t* p = in + done + 3 * i;
+            v[i] = uint32_t(p[0]) << 16 | uint32_t(p[1]) << 8 | p[2];
+        }
+
+        bytes_t sextets = bytes_t((v >> 18) | ((v >> 12 & 0x3f) << 8) | ((v >> 6 & 0x3f) << 16) | ((v & 0x3f) << 24));
+        bytes_t chars = sextets + 'A'
+                        + (IN_RANGE(sextets, 26, 63) & ('a' - 'A' - 26))
+                        - (IN_RANGE(sextets, 52, 63) & ('a' - 26 - '0' + 52))
+                        - (IN_RANGE(sextets, 62, 63) & ('0' - 52 - '+' + 62))
+                        + (IN_RANGE(sextets, 63, 63) & ('/' - '+' - 1));
+
+        std::memcpy(out + done / 3 * 4, &chars, sizeof(chars));
+    }
+    return done;
+}
+
+__VECTOR_CLONES size_t decodeBase64Vectors(const char* text, size_t size, uint8_t* out, int& invalid) noexcept
+{
+    constexpr size_t LANES = VECTOR_SIZE / 4;
+
+    bytes_t bad{};
+    size_t done = 0;
+    for (; size - done >= VECTOR_SIZE; done += VECTOR_SIZE) {
+        bytes_t c;
+        std::memcpy(&c, text + done, sizeof(c));
+
+        bytes_t upper = IN_RANGE(c, 'A', 'Z');
+        bytes_t lower = IN_RANGE(c, 'a', 'z');
+        bytes_t digit = IN_RANGE(c, '0', '9');
+        bytes_t plus = bytes_t(c == uint8_t('+'));
+        bytes_t slash = bytes_t(c == uint8_t('/'));
+        bad |= ~(upper | lower | digit | plus | slash);
+
+        dwords_t s = dwords_t((upper & (c - 'A')) | (lower & (c - ('a' - 26))) | (digit & (c + (52 - '0'))) |
+                              (plus & 62) | (slash & 63));
+        dwords_t v = (s & 0x3f) << 18 | (s >> 8 & 0x3f) << 12 | (s >> 16 & 0x3f) << 6 | s >> 24;
+
+        uint8_t* dst = out + done / 4 * 3;
+        for (size_t i = 0; i < LANES; ++i) {
+            dst[3 * i] = uint8_t(v[i] >> 16);
+            dst[3 * i + 1] = uint8_t(v[i] >> 8);
+            dst[3 * i + 2] = uint8_t(v[i]);
+        }
+    }
+
+    for (size_t i = 0; i < VECTOR_SIZE; ++i)
+        invalid |= -int(bad[i] >> 7);
+    return done;
+}
+#else
+size_t encodeHexVectors(const uint8_t*, size_t, char*) noexcept
+{
+    return 0;
+}
+
+size_t decodeHexVectors(const char*, size_t, uint8_t*, int&) noexcept
+{
+    return 0;
+}
+
+size_t encodeBase64Vectors(const uint8_t*, size_t, char*) noexcept
+{
+    return 0;
+}
+
+size_t decodeBase64Vectors(const char*, size_t, uint8_t*, int&) noexcept
+{
+    return 0;
+}
+#endif
+
+} // namespace
+
+size_t hex_decoded_size(size_t size) noexcept
+{
+    return size % 2 ? CODEC_INVALID_SIZE : size / 2;
+}
+
+size_t base64_decoded_size(const char* text, size_t size) noexcept
+{
+    if (size % 4)
+        return CODEC_INVALID_SIZE;
+    if (size == 0)
+        return 0;
+
+    size_t padding = text[size - 1] == '=' ? (text[size - 2] == '=' ? 2 : 1) : 0;
+    return size / 4 * 3 - padding;
+}
+
+void encode_hex(const uint8_t* in, size_t size, char* out) noexcept
+{
+    for (size_t i = encodeHexVectors(in, size, out); i < size; ++i) {
+        out[2 * i] = hexDigit(in[i] >> 4);
+        out[2 * i + 1] = hexDigit(in[i] & 0xf);
+    }
+    burn_stack(VECTOR_STACK_DEPTH);
+}
+
+bool decode_hex(const char* text, size_t size, uint8_t* out) noexcept
+{
+    int invalid = 0;
+    for (size_t i = decodeHexVectors(text, size, out, invalid); i + 1 < size; i += 2) {
+        int high = hexValue(uint8_t(text[i]), invalid);
+        out[i / 2] = uint8_t(high << 4 | hexValue(uint8_t(text[i + 1]), invalid));
+    }
+    burn_stack(VECTOR_STACK_DEPTH);
+    return invalid == 0 && size % 2 == 0;
+}
+
+void encode_base64(const uint8_t* in, size_t size, char* out) noexcept
+{
+    size_t i = encodeBase64Vectors(in, size, out);
+    char* dst = out + i / 3 * 4;
+
+    for (; size - i >= 3; i += 3, dst += 4) {
+        uint32_t v = uint32_t(in[i]) << 16 | uint32_t(in[i + 1]) << 8 | in[i + 2];
+        dst[0] = base64Digit(v >> 18);
+        dst[1] = base64Digit(v >> 12 & 0x3f);
+        dst[2] = base64Digit(v >> 6 & 0x3f);
+        dst[3] = base64Digit(v & 0x3f);
+    }
+
+    if (size > i) {
+        uint32_t v = uint32_t(in[i]) << 16 | (size - i > 1 ? uint32_t(in[i + 1]) << 8 : 0);
+        dst[0] = base64Digit(v >> 18);
+        dst[1] = base64Digit(v >> 12 & 0x3f);
+        dst[2] = size - i > 1 ? base64Digit(v >> 6 & 0x3f) : '=';
+        dst[3] = '=';
+    }
+    burn_stack(VECTOR_STACK_DEPTH);
+}
+
+bool decode_base64(const char* text, size_t size, uint8_t* out) noexcept
+{
+    size_t decoded = base64_decoded_size(text, size);
+    if (decoded == CODEC_INVALID_SIZE)
+        return false;
+    if (size == 0)
+        return true;
+
+    // the last quad may be padded and is decoded on its own
+    int invalid = 0;
+    size_t i = decodeBase64Vectors(text, size - 4, out, invalid);
+    uint8_t* dst = out + i / 4 * 3;
+
+    for (; i < size; i += 4) {
+        size_t valid = i + 4 < size ? 4 : 4 - (size / 4 * 3 - decoded);
+        uint32_t v = 0;
+        for (size_t j = 0; j < 4; ++j)
+            v = v << 6 | uint32_t(j < valid ? base64Value(uint8_t(text[i + j]), invalid) : 0);
+
+        for (size_t j = 0; j + 1 < valid; ++j)
+            *dst++ = uint8_t(v >> (16 - 8 * j));
+    }
+    burn_stack(VECTOR_STACK_DEPTH);
+    return invalid == 0;
+}
@@ -0,0 +1,44 @@
+#ifndef CODEC_H
+#define CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr size_t CODEC_INVALID_SIZE = SIZE_MAX;
+
+/**
+ * Constant-time hex and base64 (RFC 4648, padded) codecs. Characters are
+ * classified and mapped with masks instead of branches or lookup tables, a
+ * vector at a time (the AVX2 variant is picked at runtime where the compiler
+ * supports it), so the timing depends on the lengths only. Output buffers are
+ * written exactly once and nothing is buffered elsewhere; the stack below the
+ * call is scrubbed before returning.
+ *
+ * The decoders return false if a character is not part of the alphabet, after
+ * having processed the whole input. The contents of \p out are unspecified
+ * then and should be wiped.
+ */
+constexpr size_t hex_encoded_size(size_t bytes) noexcept
+{
+    return 2 * bytes;
+}
+
+constexpr size_t base64_encoded_size(size_t bytes) noexcept
+{
+    return (bytes + 2) / 3 * 4;
+}
+
+/**
+ * Decoded sizes; CODEC_INVALID_SIZE if \p size cannot be a valid encoding.
+ * base64_decoded_size looks at the padding at the end of \p text.
+ */
+size_t hex_decoded_size(size_t size) noexcept;
+size_t base64_decoded_size(const char* text, size_t size) noexcept;
+
+void encode_hex(const uint8_t* in, size_t size, char* out) noexcept;
+bool decode_hex(const char* text, size_t size, uint8_t* out) noexcept;
+
+void encode_base64(const uint8_t* in, size_t size, char* out) noexcept;
+bool decode_base64(const char* text, size_t size, uint8_t* out) noexcept;
+
+#endif // CODEC_H
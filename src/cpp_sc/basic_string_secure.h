@@ -1,12 +1,25 @@
 #ifndef BASIC_STRING_SECURE_H
 #define BASIC_STRING_SECURE_H
 
+#include <concepts>
+#include <cstdint>
 #include <cstring>
+#include <ranges>
 #include <string>
+#include <string_view>
 
+#include "growth_policy.h"
 #include "sanitizing_allocator.h"
 
-template <typename CharT, SanitizingAllocatorDerived Allocator = sanitizing_allocator<CharT>>
+/**
+ * \class basic_string_secure
+ * \brief std::basic_string that wipes its characters when it releases them
+ *
+ * Growth applies to push_back, append, operator+= and resize, see
+ * growth_policy.h; other insertions grow the standard way.
+ */
+template <typename CharT, SanitizingAllocatorDerived Allocator = sanitizing_allocator<CharT>,
+          GrowthPolicy Growth = standard_growth>
 class basic_string_secure : public std::basic_string<CharT, std::char_traits<CharT>, Allocator> {
 public:
     using std::basic_string<CharT, std::char_traits<CharT>, Allocator>::basic_string;
@@ -32,12 +45,54 @@ public:
         swap(*this, other);
     }
 
-    constexpr basic_string_secure& operator=(basic_string_secure other) noexcept
+    constexpr basic_string_secure& operator=(basic_string_secure&& other) noexcept
     {
-        swap(*this, other);
+        // the old contents go to a temporary and are wiped with it right away,
+        // not left behind in other
+        basic_string_secure moved(std::move(other));
+        swap(*this, moved);
+        return *this;
+    }
+
+    basic_string_secure& operator=(const CharT* s)
+    {
+        return assign_secure(s);
+    }
+
+    /**
+     * \fn assign_secure
+     * \brief Copies characters into this string, reusing the existing capacity
+     * when it is large enough
+     *
+     * Unlike `x = string_secure::copy(y)` no new buffer is allocated unless the
+     * current one is too small, and the characters dropped from the end are
+     * wiped in place.
+     */
+    basic_string_secure& assign_secure(const basic_string_secure& other)
+    {
+        if (this != &other)
+            assign_secure(other.data(), other.size());
         return *this;
     }
 
+    basic_string_secure& assign_secure(const CharT* s, size_type count)
+    {
+        size_type oldSize = this->size();
+        std::basic_string<CharT, std::char_traits<CharT>, Allocator>::assign(s, count);
+        sanitizeTail(oldSize);
+        return *this;
+    }
+
+    basic_string_secure& assign_secure(const CharT* s)
+    {
+        return assign_secure(s, std::char_traits<CharT>::length(s));
+    }
+
+    basic_string_secure& assign_secure(std::basic_string_view<CharT> sv)
+    {
+        return assign_secure(sv.data(), sv.size());
+    }
+
     [[nodiscard]] static basic_string_secure copy(const basic_string_secure& other, size_type pos,
                                                   const Allocator& alloc = Allocator())
     {
@@ -67,6 +122,45 @@ public:
         return basic_string_secure(other, alloc);
     }
 
+    /**
+     * \fn copy_range
+     * \brief Copies the characters of a range into a new string with a single
+     * allocation where the length can be known
+     *
+     * The length is taken from ranges::size, or from \p sizeHint, or by walking
+     * a forward range once. Contiguous ranges are appended in one piece.
+     */
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, CharT>
+    [[nodiscard]] static basic_string_secure copy_range(R&& range, size_type sizeHint = 0,
+                                                        const Allocator& alloc = Allocator())
+    {
+        basic_string_secure result(alloc);
+        if constexpr (std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                      std::is_same_v<std::ranges::range_value_t<R>, CharT>) {
+            result.append(std::ranges::data(range), size_type(std::ranges::size(range)));
+            return result;
+        } else if constexpr (std::ranges::sized_range<R>) {
+            result.reserve(size_type(std::ranges::size(range)));
+        } else if constexpr (std::ranges::forward_range<R>) {
+            result.reserve(sizeHint ? sizeHint : size_type(std::ranges::distance(range)));
+        } else {
+            result.reserve(sizeHint);
+        }
+
+        for (auto&& ch : range)
+            result.push_back(ch);
+        return result;
+    }
+
+#ifdef __cpp_lib_containers_ranges
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, CharT>
+    basic_string_secure(std::from_range_t, R&& range, const Allocator& alloc = Allocator())
+        : basic_string_secure(copy_range(std::forward<R>(range), 0, alloc))
+    {}
+#endif // __cpp_lib_containers_ranges
+
     /**
      * \fn  ~basic_string_secure()
      * \brief Custom destructor that clear memory for short strings
@@ -81,11 +175,145 @@ public:
     ~basic_string_secure()
     {
         auto n = this->size();
+        growth_policy_record<Growth>(n);
         if (n < 16) {
             Allocator::sanitize(this->data(), n);
         }
     }
 
+    // Shrinking operations wipe the characters they drop right away instead of
+    // leaving them in the capacity until the buffer is deallocated.
+
+    constexpr void resize(size_type count)
+    {
+        size_type oldSize = this->size();
+        if constexpr (!STANDARD_GROWTH)
+            growFor(count);
+        std::basic_string<CharT, std::char_traits<CharT>, Allocator>::resize(count);
+        sanitizeTail(oldSize);
+    }
+
+    constexpr void resize(size_type count, CharT ch)
+    {
+        size_type oldSize = this->size();
+        if constexpr (!STANDARD_GROWTH)
+            growFor(count);
+        std::basic_string<CharT, std::char_traits<CharT>, Allocator>::resize(count, ch);
+        sanitizeTail(oldSize);
+    }
+
+    constexpr basic_string_secure& erase(size_type index = 0, size_type count = basic_string_secure::npos)
+    {
+        size_type oldSize = this->size();
+        std::basic_string<CharT, std::char_traits<CharT>, Allocator>::erase(index, count);
+        sanitizeTail(oldSize);
+        return *this;
+    }
+
+    constexpr auto erase(typename basic_string_secure::const_iterator pos)
+    {
+        size_type oldSize = this->size();
+        auto it = std::basic_string<CharT, std::char_traits<CharT>, Allocator>::erase(pos);
+        sanitizeTail(oldSize);
+        return it;
+    }
+
+    constexpr auto erase(typename basic_string_secure::const_iterator first,
+                         typename basic_string_secure::const_iterator last)
+    {
+        size_type oldSize = this->size();
+        auto it = std::basic_string<CharT, std::char_traits<CharT>, Allocator>::erase(first, last);
+        sanitizeTail(oldSize);
+        return it;
+    }
+
+    // Appending operations reserve through the growth policy first
+
+    using std::basic_string<CharT, std::char_traits<CharT>, Allocator>::append;
+    using std::basic_string<CharT, std::char_traits<CharT>, Allocator>::operator+=;
+
+    constexpr void push_back(CharT ch)
+    {
+        if constexpr (!STANDARD_GROWTH)
+            growFor(this->size() + 1);
+        std::basic_string<CharT, std::char_traits<CharT>, Allocator>::push_back(ch);
+    }
+
+    basic_string_secure& append(const CharT* s, size_type count)
+    {
+        if constexpr (!STANDARD_GROWTH) {
+            // the standard append handles characters of this string itself
+            if (!aliases(s))
+                growFor(this->size() + count);
+        }
+        std::basic_string<CharT, std::char_traits<CharT>, Allocator>::append(s, count);
+        return *this;
+    }
+
+    basic_string_secure& append(const CharT* s)
+    {
+        return append(s, std::char_traits<CharT>::length(s));
+    }
+
+    basic_string_secure& append(size_type count, CharT ch)
+    {
+        if constexpr (!STANDARD_GROWTH)
+            growFor(this->size() + count);
+        std::basic_string<CharT, std::char_traits<CharT>, Allocator>::append(count, ch);
+        return *this;
+    }
+
+    basic_string_secure& append(const basic_string_secure& str)
+    {
+        return append(str.data(), str.size());
+    }
+
+    template <typename StringView>
+        requires std::is_convertible_v<const StringView&, std::basic_string_view<CharT>> &&
+                 (!std::is_convertible_v<const StringView&, const CharT*>)
+    basic_string_secure& append(const StringView& t)
+    {
+        std::basic_string_view<CharT> sv = t;
+        return append(sv.data(), sv.size());
+    }
+
+    basic_string_secure& operator+=(CharT ch)
+    {
+        push_back(ch);
+        return *this;
+    }
+
+    basic_string_secure& operator+=(const CharT* s)
+    {
+        return append(s);
+    }
+
+    basic_string_secure& operator+=(const basic_string_secure& str)
+    {
+        return append(str);
+    }
+
+    template <typename StringView>
+        requires std::is_convertible_v<const StringView&, std::basic_string_view<CharT>> &&
+                 (!std::is_convertible_v<const StringView&, const CharT*>)
+    basic_string_secure& operator+=(const StringView& t)
+    {
+        return append(t);
+    }
+
+    constexpr void pop_back()
+    {
+        std::basic_string<CharT, std::char_traits<CharT>, Allocator>::pop_back();
+        sanitizeTail(this->size() + 1);
+    }
+
+    constexpr void clear() noexcept
+    {
+        size_type oldSize = this->size();
+        std::basic_string<CharT, std::char_traits<CharT>, Allocator>::clear();
+        sanitizeTail(oldSize);
+    }
+
     constexpr basic_string_secure substr(size_type pos = 0, size_type count = basic_string_secure::npos) const
     {
         return std::basic_string<CharT, std::char_traits<CharT>, Allocator>::substr(pos, count);
@@ -106,6 +334,33 @@ public:
     }
 
 protected:
+    // std::basic_string grows the same way on its own
+    static constexpr bool STANDARD_GROWTH = std::is_same_v<Growth, standard_growth>;
+
+    /**
+     * Wipes the characters between the current size and \p oldSize, which a
+     * shrinking operation has just dropped. The terminating null stays intact.
+     */
+    void sanitizeTail(size_type oldSize) noexcept
+    {
+        if (this->size() < oldSize)
+            Allocator::sanitize(this->data() + this->size() + 1, oldSize - this->size());
+    }
+
+    // Reserves what the growth policy asks for if \p required does not fit
+    void growFor(size_type required)
+    {
+        if (required > this->capacity())
+            this->reserve(Growth::next_capacity(this->capacity(), required));
+    }
+
+    bool aliases(const CharT* s) const noexcept
+    {
+        auto p = reinterpret_cast<std::uintptr_t>(s);
+        auto begin = reinterpret_cast<std::uintptr_t>(this->data());
+        return p >= begin && p <= begin + this->capacity() * sizeof(CharT);
+    }
+
     constexpr basic_string_secure(CharT ch)
         : std::basic_string<CharT, std::char_traits<CharT>, Allocator>(1, ch)
     {}
@@ -140,6 +395,12 @@ protected:
     {}
 };
 
+template <typename CharT, typename Allocator, typename Growth>
+void copy_into(basic_string_secure<CharT, Allocator, Growth>& dst, const basic_string_secure<CharT, Allocator, Growth>& src)
+{
+    dst.assign_secure(src);
+}
+
 using string_secure = basic_string_secure<char>;
 using wstring_secure = basic_string_secure<wchar_t>;
 #ifdef __cpp_lib_char8_t
@@ -0,0 +1,63 @@
+#ifndef CALLOC_ALLOCATOR_H
+#define CALLOC_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "sanitizing_allocator.h"
+
+/**
+ * \class calloc_allocator
+ * \brief BasicAllocator backend returning zero-filled blocks from std::calloc
+ *
+ * The C library does not clear memory it already knows to be zero (large
+ * blocks come as fresh pages straight from the kernel), so value-initialized
+ * buffers built on this backend are not filled twice. Over-aligned types fall
+ * back to aligned ::operator new followed by a memset.
+ */
+template <typename T>
+struct calloc_allocator {
+    using value_type = T;
+
+    static constexpr bool zeroed_allocations = true;
+
+    calloc_allocator() = default;
+
+    template <typename U>
+    constexpr calloc_allocator(const calloc_allocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_t n)
+    {
+        if constexpr (alignof(T) <= alignof(std::max_align_t)) {
+            void* p = std::calloc(n ? n : 1, sizeof(T));
+            if (!p)
+                throw std::bad_alloc();
+            return static_cast<T*>(p);
+        } else {
+            void* p = ::operator new(n * sizeof(T), std::align_val_t(alignof(T)));
+            std::memset(p, 0, n * sizeof(T));
+            return static_cast<T*>(p);
+        }
+    }
+
+    void deallocate(T* p, size_t) noexcept
+    {
+        if constexpr (alignof(T) <= alignof(std::max_align_t))
+            std::free(p);
+        else
+            ::operator delete(p, std::align_val_t(alignof(T)));
+    }
+
+    friend bool operator==(const calloc_allocator&, const calloc_allocator&) noexcept
+    {
+        return true;
+    }
+};
+
+
+template <typename T>
+using zeroed_sanitizing_allocator = sanitizing_allocator_base<T, calloc_allocator>;
+
+#endif // CALLOC_ALLOCATOR_H
@@ -0,0 +1,113 @@
+#ifndef GROWTH_POLICY_H
+#define GROWTH_POLICY_H
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * Growth policies tell vector_secure and basic_string_secure how much to
+ * reserve when an insertion does not fit. Every reallocation of a secure
+ * container also copies the contents and wipes the old block, so fewer and
+ * better sized reallocations pay off more than for plain std containers. A
+ * policy is a stateless type with
+ *
+ *     static size_t next_capacity(size_t capacity, size_t required) noexcept;
+ *
+ * returning at least \p required. A policy that learns from finished
+ * containers also has
+ *
+ *     static void record(size_t size) noexcept;
+ *
+ * which containers call with their size when they are destroyed.
+ */
+template <typename P>
+concept GrowthPolicy = std::is_empty_v<P> && requires(size_t n) {
+    { P::next_capacity(n, n) } noexcept -> std::convertible_to<size_t>;
+};
+
+template <GrowthPolicy P>
+void growth_policy_record(size_t size) noexcept
+{
+    if constexpr (requires { P::record(size); })
+        P::record(size);
+}
+
+/**
+ * Doubles the capacity, as std::vector and std::basic_string do; the default.
+ */
+struct standard_growth {
+    static size_t next_capacity(size_t capacity, size_t required) noexcept
+    {
+        return std::max(2 * capacity, required);
+    }
+};
+
+/**
+ * Grows to exactly the required size, for containers filled by a few large
+ * appends or resizes that should not leave spare capacity behind. Inserting
+ * element by element reallocates every time.
+ */
+struct exact_growth {
+    static size_t next_capacity(size_t, size_t required) noexcept
+    {
+        return required;
+    }
+};
+
+/**
+ * Remembers the sizes that containers using it reach and reserves that much
+ * on the first growth of later containers, so a buffer rebuilt for every
+ * request is allocated once instead of reallocated and wiped log(n) times.
+ * Containers grown past the learned size fall back to Fallback.
+ *
+ * The Tag separates the statistics of different uses, e.g. one tag per
+ * message type, or a unique tag per construction site:
+ *
+ *     using response_buffer = vector_secure<uint8_t, sanitizing_allocator<uint8_t>,
+ *                                           learned_growth<struct response_tag>>;
+ *
+ * The learned size follows a new maximum at once and decays by 1/8 of the
+ * difference towards smaller sizes, so a single outlier does not pin the
+ * reservation. Updates are relaxed and may be lost under contention, which
+ * only delays learning.
+ */
+template <typename Tag, GrowthPolicy Fallback = standard_growth>
+struct learned_growth {
+    static size_t next_capacity(size_t capacity, size_t required) noexcept
+    {
+        size_t learned = learned_.load(std::memory_order_relaxed);
+        if (learned > capacity)
+            return std::max(learned, required);
+        return Fallback::next_capacity(capacity, required);
+    }
+
+    static void record(size_t size) noexcept
+    {
+        if (size == 0)
+            return;
+
+        size_t learned = learned_.load(std::memory_order_relaxed);
+        if (size > learned)
+            learned_.store(size, std::memory_order_relaxed);
+        else if (size < learned)
+            learned_.store(learned - (learned - size) / 8, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static size_t learned_size() noexcept
+    {
+        return learned_.load(std::memory_order_relaxed);
+    }
+
+    static void reset() noexcept
+    {
+        learned_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static inline std::atomic<size_t> learned_{0};
+};
+
+#endif // GROWTH_POLICY_H
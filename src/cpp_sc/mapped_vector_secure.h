@@ -0,0 +1,259 @@
+#ifndef MAPPED_VECTOR_SECURE_H
+#define MAPPED_VECTOR_SECURE_H
+
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "sanitizing_allocator.h"
+
+constexpr size_t MAPPED_VECTOR_THRESHOLD = 1024 * 1024;
+
+/**
+ * \class mapped_vector_secure
+ * \brief Growable secure buffer of trivially copyable elements that grows large
+ * storage in place with mremap
+ *
+ * std::vector grows by allocating a new block, copying every element and
+ * deallocating (and so wiping) the old block: three passes over memory. Below
+ * MapThreshold bytes this container does the same through Allocator. Once the
+ * capacity reaches MapThreshold the storage moves to an anonymous mapping, and
+ * from then on growth goes through remap_pages(): the kernel moves the pages to
+ * the new range, so nothing is copied and no old copy is left to wipe.
+ *
+ * With a zero-filling wipe policy the bytes between size() and capacity() of
+ * a mapping are kept zero (fresh pages are zero and every shrinking operation
+ * wipes what it drops), so growing within the mapping skips value-initialization
+ * and only the live region is wiped before the mapping is released. Other
+ * policies leave their pattern behind, so there the new elements are constructed
+ * and the whole capacity is wiped.
+ */
+template <typename T, size_t MapThreshold = MAPPED_VECTOR_THRESHOLD,
+          SanitizingAllocatorDerived Allocator = sanitizing_allocator<T>>
+    requires std::is_trivially_copyable_v<T>
+class mapped_vector_secure {
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    mapped_vector_secure() noexcept = default;
+
+    explicit mapped_vector_secure(size_type count)
+    {
+        resize(count);
+    }
+
+    mapped_vector_secure(std::initializer_list<T> init)
+    {
+        append(init.begin(), init.size());
+    }
+
+    mapped_vector_secure(mapped_vector_secure&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          capacity_(std::exchange(other.capacity_, 0)),
+          mapped_(std::exchange(other.mapped_, false))
+    {}
+
+    mapped_vector_secure& operator=(mapped_vector_secure&& other) noexcept
+    {
+        mapped_vector_secure moved(std::move(other));
+        swap(*this, moved);
+        return *this;
+    }
+
+    ~mapped_vector_secure()
+    {
+        release();
+    }
+
+    [[nodiscard]] static mapped_vector_secure copy(const mapped_vector_secure& other)
+    {
+        return copy(other.data(), other.size());
+    }
+
+    [[nodiscard]] static mapped_vector_secure copy(const T* first, size_type count)
+    {
+        mapped_vector_secure result;
+        result.append(first, count);
+        return result;
+    }
+
+    [[nodiscard]] T* data() noexcept { return data_; }
+    [[nodiscard]] const T* data() const noexcept { return data_; }
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+    [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] bool is_mapped() const noexcept { return mapped_; }
+
+    [[nodiscard]] iterator begin() noexcept { return data_; }
+    [[nodiscard]] iterator end() noexcept { return data_ + size_; }
+    [[nodiscard]] const_iterator begin() const noexcept { return data_; }
+    [[nodiscard]] const_iterator end() const noexcept { return data_ + size_; }
+
+    [[nodiscard]] reference operator[](size_type pos) noexcept { return data_[pos]; }
+    [[nodiscard]] const_reference operator[](size_type pos) const noexcept { return data_[pos]; }
+    [[nodiscard]] reference front() noexcept { return data_[0]; }
+    [[nodiscard]] reference back() noexcept { return data_[size_ - 1]; }
+
+    void reserve(size_type newCapacity)
+    {
+        if (newCapacity > capacity_)
+            reallocate(newCapacity);
+    }
+
+    void resize(size_type count)
+    {
+        if (count <= size_) {
+            truncate(count);
+            return;
+        }
+
+        grow(count);
+        if (!ZEROED_TAIL || !mapped_ || !std::is_trivially_default_constructible_v<T>) {
+            for (size_type i = size_; i < count; ++i)
+                ::new (static_cast<void*>(data_ + i)) T();
+        }
+        size_ = count;
+    }
+
+    void resize(size_type count, const T& value)
+    {
+        if (count <= size_) {
+            truncate(count);
+            return;
+        }
+
+        grow(count);
+        std::uninitialized_fill(data_ + size_, data_ + count, value);
+        size_ = count;
+    }
+
+    void push_back(const T& value)
+    {
+        grow(size_ + 1);
+        ::new (static_cast<void*>(data_ + size_)) T(value);
+        ++size_;
+    }
+
+    void append(const T* first, size_type count)
+    {
+        if (count == 0)
+            return;
+
+        grow(size_ + count);
+        std::memcpy(static_cast<void*>(data_ + size_), first, count * sizeof(T));
+        size_ += count;
+    }
+
+    void pop_back() noexcept
+    {
+        truncate(size_ - 1);
+    }
+
+    void clear() noexcept
+    {
+        truncate(0);
+    }
+
+    friend void swap(mapped_vector_secure& lhs, mapped_vector_secure& rhs) noexcept
+    {
+        std::swap(lhs.data_, rhs.data_);
+        std::swap(lhs.size_, rhs.size_);
+        std::swap(lhs.capacity_, rhs.capacity_);
+        std::swap(lhs.mapped_, rhs.mapped_);
+    }
+
+private:
+    static constexpr bool ZEROED_TAIL = wipe_policy_zero_fills<typename Allocator::wipe_policy>;
+
+    static size_type mappedBytes(size_type count) noexcept
+    {
+        size_t page = page_size();
+        return (count * sizeof(T) + page - 1) / page * page;
+    }
+
+    void grow(size_type required)
+    {
+        if (required <= capacity_)
+            return;
+
+        size_type doubled = capacity_ * 2;
+        reallocate(doubled > required ? doubled : required);
+    }
+
+    void reallocate(size_type newCapacity)
+    {
+        if (newCapacity * sizeof(T) < MapThreshold && !mapped_) {
+            Allocator alloc;
+            T* fresh = alloc.allocate(newCapacity);
+            if (size_)
+                std::memcpy(static_cast<void*>(fresh), data_, size_ * sizeof(T));
+            if (data_)
+                alloc.deallocate(data_, capacity_);
+            data_ = fresh;
+            capacity_ = newCapacity;
+            return;
+        }
+
+        void* fresh;
+        if (mapped_) {
+            fresh = remap_pages(data_, mappedBytes(capacity_), mappedBytes(newCapacity));
+            if (!fresh)
+                throw std::bad_alloc();
+        } else {
+            fresh = map_pages(mappedBytes(newCapacity));
+            if (!fresh)
+                throw std::bad_alloc();
+            if (size_)
+                std::memcpy(fresh, data_, size_ * sizeof(T));
+            if (data_)
+                Allocator().deallocate(data_, capacity_);
+        }
+
+        data_ = static_cast<T*>(fresh);
+        capacity_ = newCapacity;
+        mapped_ = true;
+    }
+
+    void truncate(size_type count) noexcept
+    {
+        if (count < size_)
+            Allocator::sanitize(data_ + count, size_ - count);
+        size_ = count;
+    }
+
+    void release() noexcept
+    {
+        if (!data_)
+            return;
+
+        if (mapped_) {
+            Allocator::sanitize(data_, ZEROED_TAIL ? size_ : capacity_);
+            unmap_pages(data_, mappedBytes(capacity_));
+        } else {
+            Allocator().deallocate(data_, capacity_);
+        }
+
+        data_ = nullptr;
+        size_ = capacity_ = 0;
+        mapped_ = false;
+    }
+
+    T* data_ = nullptr;
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+    bool mapped_ = false;
+};
+
+#endif // MAPPED_VECTOR_SECURE_H
@@ -0,0 +1,88 @@
+#ifndef PAGE_ALLOCATOR_H
+#define PAGE_ALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+
+#include "calloc_allocator.h"
+#include "sanitizing_allocator.h"
+
+constexpr size_t PAGE_ALLOCATOR_THRESHOLD = 32 * 1024 * 1024;
+
+/**
+ * \class page_allocator
+ * \brief BasicAllocator backend placing large blocks in their own anonymous mappings
+ *
+ * Blocks of at least Threshold bytes are mapped with map_pages(), smaller or
+ * over-aligned ones come from calloc_allocator. A mapped block is wiped by
+ * discard(): the kernel drops its pages instead of the CPU writing zeros over
+ * them. If the pages cannot be dropped (e.g. they are locked by mlockall)
+ * discard() fails and the block is burned as usual.
+ *
+ * Dropping pages beats burn() from a few megabytes on, but a fresh mapping
+ * pays a page fault per page on first touch, while malloc keeps reusing
+ * resident heap memory for blocks below its mmap threshold (up to 32 MiB on
+ * glibc). The default Threshold is therefore where the whole lifetime of a
+ * block gets cheaper; benchmarks/WipeBenchmark measures both crossovers.
+ */
+template <typename T, size_t Threshold = PAGE_ALLOCATOR_THRESHOLD>
+struct page_allocator {
+    using value_type = T;
+
+    static constexpr bool zeroed_allocations = true;
+
+    template <typename U>
+    struct rebind {
+        typedef page_allocator<U, Threshold> other;
+    };
+
+    page_allocator() = default;
+
+    template <typename U>
+    constexpr page_allocator(const page_allocator<U, Threshold>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_t n)
+    {
+        if (!isMapped(n))
+            return calloc_allocator<T>().allocate(n);
+
+        void* p = map_pages(n * sizeof(T));
+        if (!p)
+            throw std::bad_alloc();
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        if (isMapped(n))
+            unmap_pages(p, n * sizeof(T));
+        else
+            calloc_allocator<T>().deallocate(p, n);
+    }
+
+    /**
+     * Wipes a block by dropping its pages. Returns false if the block has to be
+     * wiped by the caller instead.
+     */
+    static bool discard(T* p, size_t n) noexcept
+    {
+        return isMapped(n) && discard_pages(p, n * sizeof(T));
+    }
+
+    friend bool operator==(const page_allocator&, const page_allocator&) noexcept
+    {
+        return true;
+    }
+
+private:
+    static constexpr bool isMapped(size_t n) noexcept
+    {
+        return alignof(T) <= alignof(std::max_align_t) && n * sizeof(T) >= Threshold;
+    }
+};
+
+
+template <typename T>
+using paged_sanitizing_allocator = sanitizing_allocator_base<T, page_allocator>;
+
+#endif // PAGE_ALLOCATOR_H
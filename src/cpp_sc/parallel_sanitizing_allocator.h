@@ -0,0 +1,31 @@
+#ifndef PARALLEL_SANITIZING_ALLOCATOR_H
+#define PARALLEL_SANITIZING_ALLOCATOR_H
+
+#include <memory>
+
+#include "parallel_burn.h"
+#include "sanitizing_allocator.h"
+
+/**
+ * Zero-fills blocks with parallel_burn().
+ */
+struct parallel_zero_fill {
+    static constexpr bool zero_fills = true;
+
+    template <typename T>
+    static void wipe(T* p, size_t n) noexcept
+    {
+        parallel_burn(static_cast<void*>(p), n * sizeof(T));
+    }
+};
+
+/**
+ * Sanitizing allocator whose wipes of at least parallel_wipe_threshold() bytes
+ * are spread over a worker pool; deallocate() returns once the whole block is
+ * wiped. Meant for gigabyte-scale buffers, whose teardown latency then drops
+ * roughly with the number of cores.
+ */
+template <typename T, template <typename> typename BasicAllocator = std::allocator>
+using parallel_sanitizing_allocator = sanitizing_allocator_base<T, BasicAllocator, parallel_zero_fill{}>;
+
+#endif // PARALLEL_SANITIZING_ALLOCATOR_H
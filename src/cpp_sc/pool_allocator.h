@@ -0,0 +1,69 @@
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <cstddef>
+
+#include "block_pool.h"
+#include "calloc_allocator.h"
+#include "sanitizing_allocator.h"
+
+/**
+ * \class pool_allocator
+ * \brief BasicAllocator backend serving small blocks from a shared block pool
+ *
+ * Blocks of up to POOL_MAX_BLOCK_SIZE bytes come from per-size free lists,
+ * larger or over-aligned requests go to calloc_allocator. Every block is
+ * returned zero-filled; blocks wiped on release are reused without clearing.
+ */
+template <typename T>
+struct pool_allocator {
+    using value_type = T;
+
+    static constexpr bool zeroed_allocations = true;
+
+    pool_allocator() = default;
+
+    template <typename U>
+    constexpr pool_allocator(const pool_allocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_t n)
+    {
+        if (isPooled(n))
+            return static_cast<T*>(pool_allocate(n * sizeof(T)));
+
+        return calloc_allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        if (isPooled(n))
+            pool_deallocate(p, n * sizeof(T));
+        else
+            calloc_allocator<T>().deallocate(p, n);
+    }
+
+    void deallocate_zeroed(T* p, size_t n) noexcept
+    {
+        if (isPooled(n))
+            pool_deallocate_zeroed(p, n * sizeof(T));
+        else
+            calloc_allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(const pool_allocator&, const pool_allocator&) noexcept
+    {
+        return true;
+    }
+
+private:
+    static constexpr bool isPooled(size_t n) noexcept
+    {
+        return alignof(T) <= POOL_BLOCK_ALIGNMENT && n * sizeof(T) <= POOL_MAX_BLOCK_SIZE;
+    }
+};
+
+
+template <typename T>
+using pooled_sanitizing_allocator = sanitizing_allocator_base<T, pool_allocator>;
+
+#endif // POOL_ALLOCATOR_H
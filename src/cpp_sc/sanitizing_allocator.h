@@ -3,28 +3,99 @@
 
 #include <cstdint>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include "platform.h"
+#include "wipe_policy.h"
 
+/**
+ * Passed to allocator_traits::construct to value-initialize an element that
+ * lies in a block allocated zero-filled and not written since, see
+ * sanitizing_allocator_base::construct.
+ */
+struct zeroed_element_t {
+    explicit zeroed_element_t() = default;
+};
+
+inline constexpr zeroed_element_t zeroed_element{};
+
+/**
+ * Wipe is a wipe policy object (see wipe_policy.h), e.g. `pattern_fill<0xa5>{}`,
+ * or a cleanse function `void(void*, size_t)` such as &burn.
+ */
 template <typename T, template <typename> typename BasicAllocator,
-        void(*CleanseFunc)(void*, size_t) = &burn>
+        auto Wipe = zero_fill{}>
+    requires WipePolicy<wipe_policy_t<Wipe>>
 struct sanitizing_allocator_base : public BasicAllocator<T> {
     using BasicAllocator<T>::BasicAllocator;
 
+    using wipe_policy = wipe_policy_t<Wipe>;
+
     template<typename U>
     struct rebind {
-        typedef sanitizing_allocator_base<U, BasicAllocator, CleanseFunc> other;
+        typedef sanitizing_allocator_base<U, BasicAllocator, Wipe> other;
     };
 
+    /**
+     * True when every block returned by allocate() is zero-filled. A
+     * BasicAllocator advertises this with `static constexpr bool
+     * zeroed_allocations = true`; containers then skip the fill when they
+     * value-initialize freshly allocated elements.
+     */
+    static constexpr bool allocates_zeroed = [] {
+        if constexpr (requires { BasicAllocator<T>::zeroed_allocations; })
+            return BasicAllocator<T>::zeroed_allocations;
+        else
+            return false;
+    }();
+
     static void sanitize(T* p, size_t n)
     {
-        CleanseFunc(p, n * sizeof(T));
+        wipe_policy::template wipe<T>(p, n);
     }
 
+    /**
+     * Value-initializes a scalar in a zero-filled block by leaving its bytes
+     * as they are. Containers pass zeroed_element only for elements past
+     * everything they have written to the block.
+     */
+    template <typename U>
+        requires allocates_zeroed && std::is_scalar_v<U>
+    static void construct(U*, zeroed_element_t) noexcept
+    {}
+
+    // The construct() above hides the one of BasicAllocator, if it has one
+    template <typename U, typename... Args>
+        requires requires(BasicAllocator<T>& a, U* p, Args&&... args) { a.construct(p, std::forward<Args>(args)...); }
+    void construct(U* p, Args&&... args)
+    {
+        BasicAllocator<T>::construct(p, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Blocks wiped by a zero-filling policy are all zero, so a BasicAllocator
+     * that provides deallocate_zeroed() can hand them out again without
+     * clearing them. A BasicAllocator that can zero a block more cheaply (e.g.
+     * by dropping its pages) provides `static bool discard(T*, size_t)`, which
+     * is tried first.
+     */
     void deallocate(T* p, size_t n)
     {
-        CleanseFunc(p, n);
-        BasicAllocator<T>::deallocate(p, n);
+        constexpr bool zeroFills = wipe_policy_zero_fills<wipe_policy>;
+
+        if constexpr (zeroFills && requires { BasicAllocator<T>::discard(p, n); }) {
+            if (BasicAllocator<T>::discard(p, n)) {
+                BasicAllocator<T>::deallocate(p, n);
+                return;
+            }
+        }
+
+        sanitize(p, n);
+        if constexpr (zeroFills && requires { BasicAllocator<T>::deallocate_zeroed(p, n); })
+            BasicAllocator<T>::deallocate_zeroed(p, n);
+        else
+            BasicAllocator<T>::deallocate(p, n);
     }
 };
 
@@ -35,11 +106,18 @@ using sanitizing_allocator = sanitizing_allocator_base<T, std::allocator>;
 static_assert(sizeof(sanitizing_allocator<void>) == sizeof(std::allocator<void>),
               "Size of sanitizing_allocator is not equal to size of std::allocator");
 
+/**
+ * Sanitizing allocator that also evicts wiped blocks from the CPU caches.
+ */
+template <typename T>
+using evicting_sanitizing_allocator = sanitizing_allocator_base<T, std::allocator, wipe_and_flush<>{}>;
+
 
-template <typename Derived, template <typename, template <typename> typename> typename Base>
+template <typename Derived,
+          template <typename, template <typename> typename, auto> typename Base>
 struct is_derived_from {
-    template <typename T, template <typename> typename Alloc>
-    static std::true_type __test(Base<T, Alloc>*);
+    template <typename T, template <typename> typename Alloc, auto W>
+    static std::true_type __test(Base<T, Alloc, W>*);
 
     static std::false_type __test(...);
 
@@ -0,0 +1,168 @@
+#ifndef SANITIZING_MEMORY_RESOURCE_H
+#define SANITIZING_MEMORY_RESOURCE_H
+
+#include <cstddef>
+#include <memory_resource>
+
+#include "basic_string_secure.h"
+#include "vector_secure.h"
+
+/**
+ * \class sanitizing_memory_resource
+ * \brief std::pmr::memory_resource that wipes every block it returns upstream
+ *
+ * Put it below an arena (e.g. as the upstream of monotonic_buffer_resource or
+ * unsynchronized_pool_resource): the containers allocated from the arena are
+ * then wiped together, one large chunk at a time, when the arena releases its
+ * memory, instead of once per container.
+ */
+class sanitizing_memory_resource : public std::pmr::memory_resource {
+public:
+    explicit sanitizing_memory_resource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+        : upstream_(upstream)
+    {}
+
+    sanitizing_memory_resource(const sanitizing_memory_resource&) = delete;
+    sanitizing_memory_resource& operator=(const sanitizing_memory_resource&) = delete;
+
+    [[nodiscard]] std::pmr::memory_resource* upstream_resource() const noexcept
+    {
+        return upstream_;
+    }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        burn(p, bytes);
+        upstream_->deallocate(p, bytes, alignment);
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    std::pmr::memory_resource* upstream_;
+};
+
+/**
+ * \class sanitizing_arena
+ * \brief Monotonic arena whose memory is wiped in one sweep per chunk on release()
+ *
+ * Allocation is a pointer bump; deallocation is a no-op. An optional initial
+ * buffer (e.g. on the stack) is wiped on release() as well.
+ */
+class sanitizing_arena : public std::pmr::memory_resource {
+public:
+    explicit sanitizing_arena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : wiping_(upstream), arena_(&wiping_)
+    {}
+
+    sanitizing_arena(void* buffer, size_t size,
+                     std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : wiping_(upstream), arena_(buffer, size, &wiping_), buffer_(buffer), bufferSize_(size)
+    {}
+
+    sanitizing_arena(const sanitizing_arena&) = delete;
+    sanitizing_arena& operator=(const sanitizing_arena&) = delete;
+
+    ~sanitizing_arena() override
+    {
+        release();
+    }
+
+    void release()
+    {
+        arena_.release();
+        if (buffer_)
+            burn(buffer_, bufferSize_);
+    }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        return arena_.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override
+    {}
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    sanitizing_memory_resource wiping_;
+    std::pmr::monotonic_buffer_resource arena_;
+    void* buffer_ = nullptr;
+    size_t bufferSize_ = 0;
+};
+
+
+namespace pmr {
+
+/**
+ * \class sanitizing_allocator
+ * \brief Sanitizing allocator over std::pmr::polymorphic_allocator
+ *
+ * Deallocated blocks are wiped here unless the allocator's own resource is a
+ * sanitizing_memory_resource or a sanitizing_arena, which wipe them when they
+ * are released. Any other resource, including a pool over a sanitizing one,
+ * may keep a freed block and hand it out again, so it gets the wipe. Inline
+ * buffers (string SSO) are wiped by the containers themselves. Copies keep the
+ * source's resource rather than falling back to the default one, so they stay
+ * on the sanitizing chain.
+ */
+template <typename T>
+struct sanitizing_allocator : public sanitizing_allocator_base<T, std::pmr::polymorphic_allocator> {
+    using sanitizing_allocator_base<T, std::pmr::polymorphic_allocator>::sanitizing_allocator_base;
+
+    template<typename U>
+    struct rebind {
+        typedef sanitizing_allocator<U> other;
+    };
+
+    void deallocate(T* p, size_t n)
+    {
+        if (!wipesOnRelease(this->resource()))
+            this->sanitize(p, n);
+        std::pmr::polymorphic_allocator<T>::deallocate(p, n);
+    }
+
+    sanitizing_allocator select_on_container_copy_construction() const
+    {
+        return sanitizing_allocator(this->resource());
+    }
+
+private:
+    static bool wipesOnRelease(std::pmr::memory_resource* resource) noexcept
+    {
+        return dynamic_cast<sanitizing_memory_resource*>(resource) != nullptr
+            || dynamic_cast<sanitizing_arena*>(resource) != nullptr;
+    }
+};
+
+template <typename T>
+using vector_secure = ::vector_secure<T, sanitizing_allocator<T>>;
+
+template <typename CharT>
+using basic_string_secure = ::basic_string_secure<CharT, sanitizing_allocator<CharT>>;
+
+using string_secure = basic_string_secure<char>;
+using wstring_secure = basic_string_secure<wchar_t>;
+#ifdef __cpp_lib_char8_t
+using u8string_secure = basic_string_secure<char8_t>;
+#endif // __cpp_lib_char8_t
+using u16string_secure = basic_string_secure<char16_t>;
+using u32string_secure = basic_string_secure<char32_t>;
+
+} // namespace pmr
+
+#endif // SANITIZING_MEMORY_RESOURCE_H
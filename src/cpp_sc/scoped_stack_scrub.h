@@ -0,0 +1,60 @@
+#ifndef SCOPED_STACK_SCRUB_H
+#define SCOPED_STACK_SCRUB_H
+
+#include <cstddef>
+
+#include "platform.h"
+
+constexpr size_t STACK_SCRUB_DEPTH = 16 * 1024;
+
+/**
+ * \class scoped_stack_scrub
+ * \brief Wipes the stack used by secret-handling calls made inside its scope
+ *
+ * Key material ends up in the stack frames (and register spills) of the
+ * functions that process it. On construction the MaxDepth bytes below the
+ * current frame are painted with sparse canaries; on scope exit (or scrub())
+ * the deepest overwritten canary gives the depth the calls actually reached,
+ * and only that span is wiped instead of the whole MaxDepth region.
+ *
+ *     {
+ *         scoped_stack_scrub scrub;
+ *         derive_key(password, key);
+ *     }
+ *
+ * Calls that go deeper than MaxDepth are only scrubbed down to MaxDepth. The
+ * few dozen bytes right below the current frame are taken by the scrubbing
+ * helper's own frame, so they are overwritten by its return address and saved
+ * registers rather than zeroed.
+ */
+class scoped_stack_scrub {
+public:
+    explicit scoped_stack_scrub(size_t maxDepth = STACK_SCRUB_DEPTH) noexcept
+        : maxDepth_(maxDepth), top_(paint_stack(maxDepth))
+    {}
+
+    scoped_stack_scrub(const scoped_stack_scrub&) = delete;
+    scoped_stack_scrub& operator=(const scoped_stack_scrub&) = delete;
+
+    ~scoped_stack_scrub()
+    {
+        if (top_)
+            scrub_painted_stack(top_, maxDepth_);
+    }
+
+    /**
+     * Wipes now instead of on scope exit. Returns the number of bytes wiped.
+     */
+    size_t scrub() noexcept
+    {
+        size_t wiped = top_ ? scrub_painted_stack(top_, maxDepth_) : 0;
+        top_ = nullptr;
+        return wiped;
+    }
+
+private:
+    size_t maxDepth_;
+    void* top_;
+};
+
+#endif // SCOPED_STACK_SCRUB_H
@@ -0,0 +1,138 @@
+#ifndef SEALED_SECURE_H
+#define SEALED_SECURE_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "seal_key.h"
+
+/**
+ * Secure containers of trivially copyable elements that can be copied with
+ * Container::copy, e.g. vector_secure<uint8_t> or string_secure.
+ */
+template <typename Container>
+concept Sealable = std::ranges::contiguous_range<Container> && std::ranges::sized_range<Container> &&
+                   std::is_trivially_copyable_v<std::ranges::range_value_t<Container>> &&
+                   requires(const Container& c) {
+                       { Container::copy(c) } -> std::same_as<Container>;
+                   };
+
+/**
+ * \class sealed_secure
+ * \brief Keeps a container encrypted with a per-process key while it is not in use
+ *
+ * The contents are encrypted with ChaCha20 under the process sealing key
+ * (see seal_key.h), so a memory disclosure only shows ciphertext. unseal()
+ * decrypts into a scratch copy that lives as long as the returned guard: the
+ * guard of a mutable sealed_secure seals the scratch copy again under a fresh
+ * nonce and takes it as the new contents, the guard of a const one just lets
+ * the copy be wiped.
+ *
+ *     sealed_secure<vector_secure<uint8_t>> key(secure_random::generate<vector_secure<uint8_t>>(32));
+ *     {
+ *         auto plain = std::as_const(key).unseal();
+ *         use(plain->data(), plain->size());
+ *     } // plaintext wiped here
+ */
+template <Sealable Container>
+class sealed_secure {
+public:
+    template <bool Mutable>
+    class unsealed {
+    public:
+        using container_type = std::conditional_t<Mutable, Container, const Container>;
+
+        unsealed(const unsealed&) = delete;
+        unsealed& operator=(const unsealed&) = delete;
+
+        ~unsealed()
+        {
+            if constexpr (Mutable) {
+                next_seal_nonce(owner_.nonce_);
+                sealed_secure::apply(scratch_, owner_.nonce_);
+                owner_.data_ = std::move(scratch_);
+            }
+        }
+
+        container_type& get() noexcept { return scratch_; }
+        container_type& operator*() noexcept { return scratch_; }
+        container_type* operator->() noexcept { return &scratch_; }
+
+    private:
+        friend class sealed_secure;
+        using owner_type = std::conditional_t<Mutable, sealed_secure, const sealed_secure>;
+
+        explicit unsealed(owner_type& owner)
+            : owner_(owner)
+            , scratch_(Container::copy(owner.data_))
+        {
+            sealed_secure::apply(scratch_, owner.nonce_);
+        }
+
+        owner_type& owner_;
+        Container scratch_;
+    };
+
+    sealed_secure() = default;
+
+    explicit sealed_secure(Container&& plain)
+        : data_(std::move(plain))
+    {
+        next_seal_nonce(nonce_);
+        apply(data_, nonce_);
+    }
+
+    sealed_secure(sealed_secure&&) noexcept = default;
+    sealed_secure& operator=(sealed_secure&&) noexcept = default;
+
+    [[nodiscard]] static sealed_secure copy(const sealed_secure& other)
+    {
+        return sealed_secure(other);
+    }
+
+    /**
+     * Decrypted view for reading and modification, sealed again on exit.
+     */
+    [[nodiscard]] unsealed<true> unseal()
+    {
+        return unsealed<true>(*this);
+    }
+
+    /**
+     * Decrypted read-only view; the sealed contents are left untouched.
+     */
+    [[nodiscard]] unsealed<false> unseal() const
+    {
+        return unsealed<false>(*this);
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return std::ranges::size(data_); }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * The ciphertext, e.g. for checking that nothing is stored in the clear.
+     */
+    [[nodiscard]] const Container& sealed_data() const noexcept { return data_; }
+
+private:
+    sealed_secure(const sealed_secure& other)
+        : data_(Container::copy(other.data_))
+    {
+        std::memcpy(nonce_, other.nonce_, sizeof(nonce_));
+    }
+
+    static void apply(Container& c, const uint8_t* nonce)
+    {
+        seal_xor(std::ranges::data(c), std::ranges::size(c) * sizeof(std::ranges::range_value_t<Container>), nonce);
+    }
+
+    Container data_;
+    uint8_t nonce_[CHACHA20_NONCE_SIZE] = {};
+};
+
+#endif // SEALED_SECURE_H
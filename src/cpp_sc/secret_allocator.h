@@ -0,0 +1,60 @@
+#ifndef SECRET_ALLOCATOR_H
+#define SECRET_ALLOCATOR_H
+
+#include <cstddef>
+
+#include "sanitizing_allocator.h"
+#include "secret_pool.h"
+
+/**
+ * \class secret_allocator
+ * \brief BasicAllocator backend placing blocks in memfd_secret memory
+ *
+ * Blocks are suballocated from a few memfd_secret regions (see secret_pool.h),
+ * which the kernel keeps out of its direct map, so they cannot be read through
+ * it or swapped out. Where memfd_secret is unavailable (older kernels, or
+ * disabled by the secretmem boot option) locked anonymous memory is used;
+ * secret_memory_kind() tells which one is in effect. Blocks are not inherited
+ * by fork()ed children: memfd_secret regions are not mapped there, and locked
+ * memory reads as zeros (MADV_WIPEONFORK; on systems without it the child gets
+ * a copy).
+ */
+template <typename T>
+struct secret_allocator {
+    using value_type = T;
+
+    static constexpr bool zeroed_allocations = true;
+
+    static_assert(alignof(T) <= 4096, "secret_allocator supports alignments up to the page size");
+
+    secret_allocator() = default;
+
+    template <typename U>
+    constexpr secret_allocator(const secret_allocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_t n)
+    {
+        return static_cast<T*>(secret_allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        secret_deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    void deallocate_zeroed(T* p, size_t n) noexcept
+    {
+        secret_deallocate_zeroed(p, n * sizeof(T), alignof(T));
+    }
+
+    friend bool operator==(const secret_allocator&, const secret_allocator&) noexcept
+    {
+        return true;
+    }
+};
+
+
+template <typename T>
+using secret_sanitizing_allocator = sanitizing_allocator_base<T, secret_allocator>;
+
+#endif // SECRET_ALLOCATOR_H
@@ -0,0 +1,185 @@
+#ifndef SECRET_TABLE_H
+#define SECRET_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "sanitizing_allocator.h"
+#include "vector_secure.h"
+#include "secret_scan.h"
+
+/**
+ * \class secret_table
+ * \brief Fixed-width secrets stored back to back in one sanitizing block
+ *
+ * A table of many small keys as vector_secure<vector_secure<uint8_t>> costs a
+ * heap block, a container header and a wipe per key. Here the secrets are the
+ * slots of a single block and are referred to by handles; besides the Width
+ * bytes a slot only has a 32-bit generation (odd while occupied) and an entry
+ * in the free list.
+ *
+ *     secret_table<32> keys(1000);
+ *     auto h = keys.insert(key);
+ *     ...
+ *     if (auto found = keys.find(candidate)) // constant time
+ *         ...
+ *     keys.erase(h);                          // the slot is wiped right away
+ *
+ * A handle stays valid until its secret is erased, also when the table grows;
+ * spans returned by at() are invalidated by growth like vector iterators. A
+ * handle to an erased secret is rejected even after its slot has been reused.
+ * The block is wiped in one pass by clear() and by the allocator when it is
+ * released.
+ */
+template <size_t Width, SanitizingAllocatorDerived Allocator = sanitizing_allocator<uint8_t>>
+    requires (Width > 0)
+class secret_table {
+public:
+    using secret_view = std::span<const uint8_t, Width>;
+
+    struct handle {
+        uint32_t index = 0;
+        uint32_t generation = 0;
+
+        bool operator==(const handle&) const = default;
+    };
+
+    secret_table() = default;
+
+    explicit secret_table(size_t slots)
+    {
+        reserve(slots);
+    }
+
+    secret_table(secret_table&& other) noexcept
+        : bytes_(std::move(other.bytes_)),
+          generations_(std::move(other.generations_)),
+          free_(std::move(other.free_)),
+          size_(std::exchange(other.size_, 0))
+    {}
+
+    secret_table& operator=(secret_table&& other) noexcept
+    {
+        bytes_ = std::move(other.bytes_);
+        generations_ = std::move(other.generations_);
+        free_ = std::move(other.free_);
+        size_ = std::exchange(other.size_, 0);
+        return *this;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] size_t capacity() const noexcept { return generations_.size(); }
+
+    void reserve(size_t slots)
+    {
+        if (slots <= capacity())
+            return;
+        if (slots > UINT32_MAX)
+            throw std::length_error("secret_table: too many slots");
+
+        size_t old = capacity();
+        bytes_.resize(slots * Width);
+        generations_.resize(slots);
+        free_.reserve(slots);
+        // the new slots are handed out in order, lowest index first
+        for (size_t i = slots; i-- > old;)
+            free_.push_back(uint32_t(i));
+    }
+
+    /**
+     * Copies \p secret into a free slot, growing the table if there is none.
+     */
+    handle insert(secret_view secret)
+    {
+        if (free_.empty())
+            reserve(capacity() ? 2 * capacity() : 1);
+
+        uint32_t index = free_.back();
+        free_.pop_back();
+
+        std::memcpy(slot(index), secret.data(), Width);
+        ++generations_[index];
+        ++size_;
+        return { index, generations_[index] };
+    }
+
+    /**
+     * Wipes the slot of \p h and makes it free. Returns false for a handle that
+     * is not (or no longer) valid.
+     */
+    bool erase(handle h) noexcept
+    {
+        if (!contains(h))
+            return false;
+
+        Allocator::sanitize(slot(h.index), Width);
+        ++generations_[h.index];
+        free_.push_back(h.index);
+        --size_;
+        return true;
+    }
+
+    [[nodiscard]] bool contains(handle h) const noexcept
+    {
+        return h.index < capacity() && (h.generation & 1) && generations_[h.index] == h.generation;
+    }
+
+    std::span<uint8_t, Width> at(handle h)
+    {
+        if (!contains(h))
+            throw std::out_of_range("secret_table: invalid handle");
+        return std::span<uint8_t, Width>(slot(h.index), Width);
+    }
+
+    secret_view at(handle h) const
+    {
+        if (!contains(h))
+            throw std::out_of_range("secret_table: invalid handle");
+        return secret_view(slot(h.index), Width);
+    }
+
+    /**
+     * Looks \p secret up in constant time: every slot is compared in full and
+     * the time depends on capacity() only, see secret_scan.h.
+     */
+    [[nodiscard]] std::optional<handle> find(secret_view secret) const noexcept
+    {
+        size_t index = find_secret_slot(bytes_.data(), generations_.data(), capacity(), Width, secret.data());
+        if (index == SECRET_SLOT_NOT_FOUND)
+            return std::nullopt;
+        return handle{ uint32_t(index), generations_[index] };
+    }
+
+    /**
+     * Erases all secrets with a single wipe of the block; the capacity is
+     * kept and all handles become invalid.
+     */
+    void clear() noexcept
+    {
+        Allocator::sanitize(bytes_.data(), bytes_.size());
+        free_.clear();
+        for (size_t i = capacity(); i-- > 0;) {
+            generations_[i] += generations_[i] & 1;
+            free_.push_back(uint32_t(i));
+        }
+        size_ = 0;
+    }
+
+private:
+    uint8_t* slot(uint32_t index) noexcept { return bytes_.data() + size_t(index) * Width; }
+    const uint8_t* slot(uint32_t index) const noexcept { return bytes_.data() + size_t(index) * Width; }
+
+    vector_secure<uint8_t, Allocator> bytes_;
+    std::vector<uint32_t> generations_;
+    std::vector<uint32_t> free_;
+    size_t size_ = 0;
+};
+
+#endif // SECRET_TABLE_H
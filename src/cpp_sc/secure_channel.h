@@ -0,0 +1,170 @@
+#ifndef SECURE_CHANNEL_H
+#define SECURE_CHANNEL_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "vector_secure.h"
+
+template <typename T>
+concept SecureChannelElement = std::is_nothrow_move_constructible_v<T> &&
+                               std::is_nothrow_move_assignable_v<T> &&
+                               !std::is_copy_constructible_v<T>;
+
+/**
+ * \class secure_channel
+ * \brief Bounded lock-free MPMC queue that moves secure containers between threads
+ *
+ * Based on Dmitry Vyukov's bounded MPMC queue: every slot carries a sequence
+ * number, so producers and consumers only contend on their own position counter.
+ * Elements are moved in and out, never copied. Once an element has been consumed
+ * its slot is destroyed and the slot bytes (container header and inline SSO
+ * buffer) are wiped, so no residue of the secret stays in the channel.
+ *
+ * Batch operations claim a run of slots with a single CAS on the position
+ * counter.
+ */
+template <SecureChannelElement T>
+class secure_channel {
+public:
+    explicit secure_channel(size_t capacity)
+        : slots_(std::bit_ceil(capacity < 2 ? size_t(2) : capacity)),
+          mask_(slots_.size() - 1)
+    {
+        for (size_t i = 0; i < slots_.size(); ++i)
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    secure_channel(const secure_channel&) = delete;
+    secure_channel& operator=(const secure_channel&) = delete;
+
+    ~secure_channel()
+    {
+        size_t end = enqueuePos_.load(std::memory_order_relaxed);
+        for (size_t pos = dequeuePos_.load(std::memory_order_relaxed); pos != end; ++pos)
+            release(slots_[pos & mask_]);
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept
+    {
+        return slots_.size();
+    }
+
+    bool try_push(T&& value) noexcept
+    {
+        return try_push_batch(&value, 1) == 1;
+    }
+
+    bool try_pop(T& value) noexcept
+    {
+        return try_pop_batch(&value, 1) == 1;
+    }
+
+    /**
+     * Moves up to \p count elements starting at \p first into the channel.
+     * Returns the number of elements moved; the rest are left untouched.
+     */
+    template <typename InputIt>
+    size_t try_push_batch(InputIt first, size_t count) noexcept
+    {
+        size_t pos;
+        size_t claimed = claim(enqueuePos_, pos, count, 0);
+
+        for (size_t i = 0; i < claimed; ++i, ++first) {
+            slot& s = slots_[(pos + i) & mask_];
+            ::new (static_cast<void*>(s.storage)) T(std::move(*first));
+            s.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+    /**
+     * Moves up to \p maxCount elements out of the channel into \p out.
+     * Returns the number of elements moved.
+     */
+    template <typename OutputIt>
+    size_t try_pop_batch(OutputIt out, size_t maxCount) noexcept
+    {
+        size_t pos;
+        size_t claimed = claim(dequeuePos_, pos, maxCount, 1);
+
+        for (size_t i = 0; i < claimed; ++i, ++out) {
+            slot& s = slots_[(pos + i) & mask_];
+            *out = std::move(*s.value());
+            release(s);
+            s.sequence.store(pos + i + slots_.size(), std::memory_order_release);
+        }
+        return claimed;
+    }
+
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    struct alignas(CACHE_LINE) slot {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    /**
+     * Claims a run of consecutive positions starting at the current value of
+     * \p counter. A slot at position p is ready when its sequence equals
+     * p + \p readyOffset (0 for producers, 1 for consumers).
+     */
+    size_t claim(std::atomic<size_t>& counter, size_t& pos, size_t maxCount, size_t readyOffset) noexcept
+    {
+        if (maxCount > slots_.size())
+            maxCount = slots_.size();
+
+        pos = counter.load(std::memory_order_relaxed);
+        if (maxCount == 0)
+            return 0;
+
+        for (;;) {
+            size_t ready = 0;
+            while (ready < maxCount) {
+                size_t seq = slots_[(pos + ready) & mask_].sequence.load(std::memory_order_acquire);
+                if (seq != pos + ready + readyOffset)
+                    break;
+                ++ready;
+            }
+
+            if (ready == 0) {
+                size_t seq = slots_[pos & mask_].sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(seq - (pos + readyOffset));
+                if (diff < 0)
+                    return 0; // full for producers, empty for consumers
+
+                pos = counter.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (counter.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed))
+                return ready;
+        }
+    }
+
+    static void release(slot& s) noexcept
+    {
+        std::destroy_at(s.value());
+        burn(s.storage, sizeof(T));
+    }
+
+    vector_secure<slot> slots_;
+    const size_t mask_;
+
+    alignas(CACHE_LINE) std::atomic<size_t> enqueuePos_ = 0;
+    alignas(CACHE_LINE) std::atomic<size_t> dequeuePos_ = 0;
+};
+
+#endif // SECURE_CHANNEL_H
@@ -0,0 +1,70 @@
+#ifndef SECURE_ENCODING_H
+#define SECURE_ENCODING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+#include "basic_string_secure.h"
+#include "vector_secure.h"
+#include "codec.h"
+
+/**
+ * Hex and base64 (RFC 4648, padded) conversions between secure strings and
+ * secure byte vectors, see codec.h. The result is allocated once at its exact
+ * size and written in place; the codecs do not branch on the data.
+ *
+ *     vector_secure<uint8_t> key = hex_decode(config.value("key")); // string_secure
+ *     string_secure header = base64_encode(key);
+ *
+ * The decoders accept upper and lower case hex digits and throw
+ * std::invalid_argument if the input is not a valid encoding; the partially
+ * decoded result is wiped by its allocator.
+ */
+template <typename String = basic_string_secure<char>>
+[[nodiscard]] String hex_encode(std::span<const uint8_t> bytes)
+{
+    String result;
+    result.resize(hex_encoded_size(bytes.size()));
+    encode_hex(bytes.data(), bytes.size(), result.data());
+    return result;
+}
+
+template <typename Bytes = vector_secure<uint8_t>>
+[[nodiscard]] Bytes hex_decode(std::string_view text)
+{
+    size_t size = hex_decoded_size(text.size());
+    if (size == CODEC_INVALID_SIZE)
+        throw std::invalid_argument("hex_decode: odd number of digits");
+
+    Bytes result(size);
+    if (!decode_hex(text.data(), text.size(), result.data()))
+        throw std::invalid_argument("hex_decode: invalid hex digit");
+    return result;
+}
+
+template <typename String = basic_string_secure<char>>
+[[nodiscard]] String base64_encode(std::span<const uint8_t> bytes)
+{
+    String result;
+    result.resize(base64_encoded_size(bytes.size()));
+    encode_base64(bytes.data(), bytes.size(), result.data());
+    return result;
+}
+
+template <typename Bytes = vector_secure<uint8_t>>
+[[nodiscard]] Bytes base64_decode(std::string_view text)
+{
+    size_t size = base64_decoded_size(text.data(), text.size());
+    if (size == CODEC_INVALID_SIZE)
+        throw std::invalid_argument("base64_decode: length is not a multiple of 4");
+
+    Bytes result(size);
+    if (!decode_base64(text.data(), text.size(), result.data()))
+        throw std::invalid_argument("base64_decode: invalid base64 character");
+    return result;
+}
+
+#endif // SECURE_ENCODING_H
@@ -0,0 +1,93 @@
+#ifndef SECURE_HASH_H
+#define SECURE_HASH_H
+
+#include <cstddef>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+
+#include "basic_string_secure.h"
+#include "vector_secure.h"
+#include "siphash.h"
+
+/**
+ * Contiguous ranges whose elements can be hashed as their bytes: equal
+ * elements have equal object representations.
+ */
+template <typename Range>
+concept SecureHashable = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range> &&
+                         std::has_unique_object_representations_v<std::ranges::range_value_t<Range>>;
+
+namespace detail {
+
+template <typename Range>
+size_t secureHashOf(const Range& range)
+{
+    return size_t(process_hash(std::ranges::data(range),
+                               std::ranges::size(range) * sizeof(std::ranges::range_value_t<Range>)));
+}
+
+} // namespace detail
+
+/**
+ * \class secure_hash
+ * \brief Keyed hash for secure containers in unordered containers
+ *
+ * SipHash-2-4 of the elements under a random per-process key (see siphash.h),
+ * so the hash of a key cannot be predicted and hash tables cannot be flooded
+ * with colliding keys. Strings hash like their string_view, which together
+ * with the transparent secure_hash<> allows lookups without a temporary
+ * secure string:
+ *
+ *     std::unordered_map<string_secure, int, secure_hash<>, std::equal_to<>> map;
+ *     map.find(std::string_view("key"));
+ */
+template <typename T = void>
+struct secure_hash;
+
+template <typename CharT, typename Allocator, typename Growth>
+struct secure_hash<basic_string_secure<CharT, Allocator, Growth>> {
+    size_t operator()(const basic_string_secure<CharT, Allocator, Growth>& str) const
+    {
+        return detail::secureHashOf(str);
+    }
+};
+
+template <typename CharT>
+struct secure_hash<std::basic_string_view<CharT>> {
+    size_t operator()(std::basic_string_view<CharT> str) const
+    {
+        return detail::secureHashOf(str);
+    }
+};
+
+template <typename T, typename Allocator, typename Growth>
+    requires std::has_unique_object_representations_v<T>
+struct secure_hash<vector_secure<T, Allocator, Growth>> {
+    size_t operator()(const vector_secure<T, Allocator, Growth>& vec) const
+    {
+        return detail::secureHashOf(vec);
+    }
+};
+
+template <>
+struct secure_hash<void> {
+    using is_transparent = void;
+
+    // arrays are left to the pointer overload: a string literal hashes
+    // without its terminating null
+    template <SecureHashable Range>
+        requires (!std::is_array_v<Range>)
+    size_t operator()(const Range& range) const
+    {
+        return detail::secureHashOf(range);
+    }
+
+    template <typename CharT>
+    size_t operator()(const CharT* str) const
+    {
+        return detail::secureHashOf(std::basic_string_view<CharT>(str));
+    }
+};
+
+#endif // SECURE_HASH_H
@@ -0,0 +1,139 @@
+#ifndef SECURE_IOVEC_BUILDER_H
+#define SECURE_IOVEC_BUILDER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+#include "scatter_io.h"
+
+/**
+ * \class secure_iovec_builder
+ * \brief Collects fragments of secure containers and writes them with one
+ * writev/sendmsg, without concatenating them into a new buffer first
+ *
+ * Only pointers to the fragments are stored, so the containers must outlive
+ * the write; temporaries that own their data are rejected. The fragment list
+ * keeps its capacity across clear(), so a builder reused for every response
+ * does not allocate either.
+ *
+ *     secure_iovec_builder out;
+ *     out.append(std::string_view("token=")).append(token).append(std::string_view("\r\n"));
+ *     out.send(socket);
+ *
+ * write() and send() return only once every byte has been written and throw
+ * std::system_error otherwise, see scatter_io.h.
+ */
+class secure_iovec_builder {
+public:
+    secure_iovec_builder() = default;
+
+    explicit secure_iovec_builder(size_t fragments)
+    {
+        fragments_.reserve(fragments);
+    }
+
+    // arrays are rejected so that string literals do not bring their null
+    template <std::ranges::contiguous_range Range>
+        requires std::ranges::sized_range<Range> && (!std::is_array_v<Range>)
+    secure_iovec_builder& append(const Range& range)
+    {
+        return append(std::ranges::data(range), std::ranges::size(range) * sizeof(std::ranges::range_value_t<Range>));
+    }
+
+    template <typename Range>
+        requires (!std::ranges::borrowed_range<Range>)
+    secure_iovec_builder& append(Range&&) = delete;
+
+    secure_iovec_builder& append(const void* data, size_t size)
+    {
+        if (size) {
+            fragments_.push_back({ const_cast<void*>(data), size });
+            size_ += size;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] size_t fragment_count() const noexcept { return fragments_.size(); }
+
+    void clear() noexcept
+    {
+        fragments_.clear();
+        size_ = 0;
+    }
+
+    size_t write(int fd) const
+    {
+        return write_fragments(fd, fragments_.data(), fragments_.size());
+    }
+
+    size_t send(int socket, int flags = 0) const
+    {
+        return send_fragments(socket, fragments_.data(), fragments_.size(), flags);
+    }
+
+private:
+    std::vector<io_fragment> fragments_;
+    size_t size_ = 0;
+};
+
+/**
+ * Containers read_secure can append to: contiguous storage of trivially
+ * copyable elements with a capacity.
+ */
+template <typename Container>
+concept SecureReadTarget = std::ranges::contiguous_range<Container> && std::ranges::sized_range<Container> &&
+                           std::is_trivially_copyable_v<std::ranges::range_value_t<Container>> &&
+                           requires(Container& c, size_t n) {
+                               { c.capacity() } -> std::convertible_to<size_t>;
+                               c.resize(n);
+                           };
+
+/**
+ * \fn read_secure
+ * \brief Reads from \p fd with one readv into the spare capacity of the targets
+ *
+ * The bytes are appended to the targets in order, each filled up to its
+ * capacity() before the next one; reserve() beforehand to choose how much is
+ * read. Nothing is reallocated, so no partial copy of the data is left
+ * behind. Returns the number of bytes read, 0 at end of file. Targets should
+ * hold whole elements' worth of spare bytes: a read that ends inside an
+ * element leaves that element out. At most IO_FRAGMENT_BATCH targets, the
+ * most a single readv is given.
+ */
+template <SecureReadTarget... Containers>
+size_t read_secure(int fd, Containers&... targets)
+{
+    constexpr size_t COUNT = sizeof...(Containers);
+    static_assert(COUNT <= IO_FRAGMENT_BATCH, "read_secure: too many targets for one readv");
+    const size_t sizes[COUNT] = { size_t(std::ranges::size(targets))... };
+
+    (targets.resize(targets.capacity()), ...);
+
+    io_fragment fragments[COUNT];
+    size_t i = 0;
+    ((fragments[i] = { std::ranges::data(targets) + sizes[i],
+                       (std::ranges::size(targets) - sizes[i]) * sizeof(std::ranges::range_value_t<Containers>) },
+      ++i), ...);
+
+    size_t bytes = 0;
+    try {
+        bytes = read_fragments(fd, fragments, COUNT);
+    } catch (...) {
+        i = 0;
+        (targets.resize(sizes[i++]), ...);
+        throw;
+    }
+
+    // shrinking wipes the spare capacity that was not read into
+    size_t left = bytes;
+    i = 0;
+    ((targets.resize(sizes[i] + std::min(left, fragments[i].size) / sizeof(std::ranges::range_value_t<Containers>)),
+      left -= std::min(left, fragments[i].size), ++i), ...);
+    return bytes;
+}
+
+#endif // SECURE_IOVEC_BUILDER_H
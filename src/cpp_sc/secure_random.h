@@ -0,0 +1,57 @@
+#ifndef SECURE_RANDOM_H
+#define SECURE_RANDOM_H
+
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+
+#include "random_engine.h"
+
+/**
+ * Element types whose every bit pattern is a valid, distinct value, so that
+ * random bytes make a uniformly random element.
+ */
+template <typename T>
+concept RandomFillable = std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>;
+
+/**
+ * \class secure_random
+ * \brief Random keys for secure containers from a per-thread buffered CSPRNG
+ *
+ * Draws from secure_random_bytes() (see random_engine.h), which only makes a
+ * syscall to reseed, so generating many short keys costs no syscall per key.
+ *
+ *     auto key = secure_random::generate<vector_secure<uint8_t>>(32);
+ *     secure_random::fill(nonce); // std::array<uint8_t, 12>
+ */
+struct secure_random {
+    static void fill(void* out, size_t size)
+    {
+        secure_random_bytes(out, size);
+    }
+
+    /**
+     * Overwrites every element of a contiguous container or array.
+     */
+    template <std::ranges::contiguous_range Range>
+        requires std::ranges::sized_range<Range> && RandomFillable<std::ranges::range_value_t<Range>>
+    static void fill(Range&& range)
+    {
+        secure_random_bytes(std::ranges::data(range), std::ranges::size(range) * sizeof(std::ranges::range_value_t<Range>));
+    }
+
+    /**
+     * Returns a Container of \p count random elements.
+     */
+    template <typename Container>
+        requires RandomFillable<typename Container::value_type>
+    [[nodiscard]] static Container generate(size_t count)
+    {
+        Container result;
+        result.resize(count);
+        fill(result);
+        return result;
+    }
+};
+
+#endif // SECURE_RANDOM_H
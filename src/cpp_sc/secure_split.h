@@ -0,0 +1,221 @@
+#ifndef SECURE_SPLIT_H
+#define SECURE_SPLIT_H
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "basic_string_secure.h"
+
+/**
+ * \class secure_split_view
+ * \brief Lazy range of the pieces of a string between delimiters
+ *
+ * The pieces are std::basic_string_view into the source, so splitting
+ * allocates nothing and leaves no copies to wipe; the source must outlive the
+ * view. Like std::views::split, an empty source has no pieces and a trailing
+ * delimiter ends with an empty piece; an empty delimiter yields the whole
+ * source as one piece. Single-character delimiters are searched with
+ * std::char_traits<CharT>::find, which is memchr/wmemchr for char and wchar_t.
+ */
+template <typename CharT>
+class secure_split_view : public std::ranges::view_interface<secure_split_view<CharT>> {
+public:
+    using piece_type = std::basic_string_view<CharT>;
+
+    class iterator {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = piece_type;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        piece_type operator*() const noexcept { return current_; }
+
+        iterator& operator++() noexcept
+        {
+            if (more_)
+                find(rest_);
+            else
+                parent_ = nullptr;
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const iterator& other) const noexcept
+        {
+            return parent_ == other.parent_ && (!parent_ || current_.data() == other.current_.data());
+        }
+
+        bool operator==(std::default_sentinel_t) const noexcept
+        {
+            return parent_ == nullptr;
+        }
+
+    private:
+        friend class secure_split_view;
+
+        explicit iterator(const secure_split_view* parent) noexcept
+            : parent_(parent)
+        {
+            if (parent->source_.empty())
+                parent_ = nullptr;
+            else
+                find(parent->source_);
+        }
+
+        void find(piece_type s) noexcept
+        {
+            size_t pos = parent_->find(s);
+            more_ = pos != piece_type::npos;
+            current_ = s.substr(0, more_ ? pos : s.size());
+            if (more_)
+                rest_ = s.substr(pos + parent_->delimiterSize());
+        }
+
+        const secure_split_view* parent_ = nullptr;
+        piece_type current_;
+        piece_type rest_;
+        bool more_ = false;
+    };
+
+    secure_split_view() = default;
+
+    secure_split_view(piece_type source, CharT delimiter) noexcept
+        : source_(source), single_(delimiter)
+    {}
+
+    secure_split_view(piece_type source, piece_type delimiter) noexcept
+        : source_(source), multi_(delimiter), isMulti_(true)
+    {}
+
+    iterator begin() const noexcept { return iterator(this); }
+    std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+private:
+    size_t find(piece_type s) const noexcept
+    {
+        if (!isMulti_) {
+            const CharT* p = std::char_traits<CharT>::find(s.data(), s.size(), single_);
+            return p ? size_t(p - s.data()) : piece_type::npos;
+        }
+        return multi_.empty() ? piece_type::npos : s.find(multi_);
+    }
+
+    size_t delimiterSize() const noexcept
+    {
+        return isMulti_ ? multi_.size() : 1;
+    }
+
+    piece_type source_;
+    CharT single_ = CharT();
+    piece_type multi_;
+    bool isMulti_ = false;
+};
+
+/**
+ * \fn secure_split
+ * \brief Splits a secure string (or any string view) into views of its pieces
+ *
+ *     for (auto field : secure_split(line, ','))
+ *         ...
+ *
+ * Temporary secure strings are rejected, the pieces would point into freed
+ * (and wiped) memory.
+ */
+template <typename CharT, typename Delimiter>
+    requires std::is_same_v<Delimiter, CharT> || std::is_convertible_v<const Delimiter&, std::basic_string_view<CharT>>
+[[nodiscard]] secure_split_view<CharT> secure_split(std::basic_string_view<CharT> source, const Delimiter& delimiter) noexcept
+{
+    if constexpr (std::is_same_v<Delimiter, CharT>)
+        return secure_split_view<CharT>(source, delimiter);
+    else
+        return secure_split_view<CharT>(source, std::basic_string_view<CharT>(delimiter));
+}
+
+template <typename CharT, typename Allocator, typename Growth, typename Delimiter>
+[[nodiscard]] secure_split_view<CharT> secure_split(const basic_string_secure<CharT, Allocator, Growth>& source,
+                                                   const Delimiter& delimiter) noexcept
+{
+    return secure_split(std::basic_string_view<CharT>(source), delimiter);
+}
+
+template <typename CharT, typename Allocator, typename Growth, typename Delimiter>
+secure_split_view<CharT> secure_split(basic_string_secure<CharT, Allocator, Growth>&& source, const Delimiter& delimiter) = delete;
+
+/**
+ * \fn secure_split_once
+ * \brief Splits at the first delimiter, e.g. "user:password" or "key=value";
+ * empty if there is none
+ */
+template <typename CharT, typename Allocator, typename Growth>
+[[nodiscard]] std::optional<std::pair<std::basic_string_view<CharT>, std::basic_string_view<CharT>>>
+secure_split_once(const basic_string_secure<CharT, Allocator, Growth>& source, CharT delimiter) noexcept
+{
+    std::basic_string_view<CharT> view(source);
+    size_t pos = view.find(delimiter);
+    if (pos == view.npos)
+        return std::nullopt;
+    return std::pair(view.substr(0, pos), view.substr(pos + 1));
+}
+
+template <typename CharT, typename Allocator, typename Growth>
+void secure_split_once(basic_string_secure<CharT, Allocator, Growth>&& source, CharT delimiter) = delete;
+
+/**
+ * \fn secure_join
+ * \brief Concatenates string pieces with a separator into one secure string
+ *
+ * The total length is computed first, so the result is allocated exactly
+ * once and no intermediate string is left to wipe. The pieces can be secure
+ * strings, string views or the pieces of secure_split.
+ */
+template <std::ranges::forward_range Range,
+          typename CharT = typename std::ranges::range_value_t<Range>::value_type>
+    requires std::is_convertible_v<std::ranges::range_reference_t<Range>, std::basic_string_view<CharT>>
+[[nodiscard]] basic_string_secure<CharT> secure_join(const Range& pieces,
+                                                     std::type_identity_t<std::basic_string_view<CharT>> separator)
+{
+    size_t total = 0;
+    size_t count = 0;
+    for (std::basic_string_view<CharT> piece : pieces) {
+        total += piece.size();
+        ++count;
+    }
+    if (count > 1)
+        total += separator.size() * (count - 1);
+
+    basic_string_secure<CharT> result;
+    result.reserve(total);
+    bool first = true;
+    for (std::basic_string_view<CharT> piece : pieces) {
+        if (!first)
+            result.append(separator);
+        result.append(piece);
+        first = false;
+    }
+    return result;
+}
+
+template <std::ranges::forward_range Range,
+          typename CharT = typename std::ranges::range_value_t<Range>::value_type>
+    requires std::is_convertible_v<std::ranges::range_reference_t<Range>, std::basic_string_view<CharT>>
+[[nodiscard]] basic_string_secure<CharT> secure_join(const Range& pieces, std::type_identity_t<CharT> separator)
+{
+    return secure_join(pieces, std::basic_string_view<CharT>(&separator, 1));
+}
+
+#endif // SECURE_SPLIT_H
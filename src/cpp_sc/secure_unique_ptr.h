@@ -0,0 +1,69 @@
+#ifndef SECURE_UNIQUE_PTR_H
+#define SECURE_UNIQUE_PTR_H
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "sanitizing_allocator.h"
+
+/**
+ * \class secure_delete
+ * \brief Deleter that destroys the object and returns its storage through a
+ * sanitizing allocator, which wipes sizeof(T) bytes before releasing them
+ */
+template <typename T, SanitizingAllocatorDerived Allocator = sanitizing_allocator<T>>
+struct secure_delete {
+    secure_delete() = default;
+
+    explicit secure_delete(const Allocator& alloc) noexcept
+        : alloc_(alloc)
+    {}
+
+    void operator()(T* p) const noexcept
+    {
+        std::destroy_at(p);
+        alloc_.deallocate(p, 1);
+    }
+
+private:
+    [[no_unique_address]] mutable Allocator alloc_;
+};
+
+template <typename T, SanitizingAllocatorDerived Allocator = sanitizing_allocator<T>>
+using secure_unique_ptr = std::unique_ptr<T, secure_delete<T, Allocator>>;
+
+
+template <typename T, SanitizingAllocatorDerived Allocator = sanitizing_allocator<T>, typename... Args>
+    requires (!std::is_array_v<T>)
+[[nodiscard]] secure_unique_ptr<T, Allocator> allocate_secure(const Allocator& alloc, Args&&... args)
+{
+    Allocator a(alloc);
+    T* p = a.allocate(1);
+
+    try {
+        ::new (static_cast<void*>(p)) T(std::forward<Args>(args)...);
+    } catch (...) {
+        a.deallocate(p, 1);
+        throw;
+    }
+
+    return secure_unique_ptr<T, Allocator>(p, secure_delete<T, Allocator>(a));
+}
+
+/**
+ * \fn make_secure
+ * \brief Creates a single object on the sanitizing allocator
+ *
+ * The secure counterpart of std::make_unique for objects that are not
+ * containers, e.g. key schedules. Use pooled_sanitizing_allocator<T> as
+ * Allocator to serve small objects from the block pool.
+ */
+template <typename T, SanitizingAllocatorDerived Allocator = sanitizing_allocator<T>, typename... Args>
+    requires (!std::is_array_v<T>)
+[[nodiscard]] secure_unique_ptr<T, Allocator> make_secure(Args&&... args)
+{
+    return allocate_secure<T, Allocator>(Allocator(), std::forward<Args>(args)...);
+}
+
+#endif // SECURE_UNIQUE_PTR_H
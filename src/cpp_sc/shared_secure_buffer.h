@@ -0,0 +1,77 @@
+#ifndef SHARED_SECURE_BUFFER_H
+#define SHARED_SECURE_BUFFER_H
+
+#include <concepts>
+#include <memory>
+#include <utility>
+
+#include "sanitizing_allocator.h"
+
+template <typename Container>
+concept SecureCopyable = requires(const Container& c) {
+    { Container::copy(c) } -> std::same_as<Container>;
+    typename Container::allocator_type;
+} && SanitizingAllocatorDerived<typename Container::allocator_type>;
+
+/**
+ * \class shared_secure_buffer
+ * \brief Immutable, atomically reference-counted handle to a secure container
+ *
+ * Takes ownership of a vector_secure or basic_string_secure by move. Copying
+ * the handle only bumps the reference count; the contents are destroyed and
+ * wiped once, when the last handle goes away. The control block is allocated
+ * through the container's sanitizing allocator, so the container header
+ * (including inline SSO bytes) is wiped as well.
+ *
+ * Use copy() to get a mutable deep copy.
+ */
+template <SecureCopyable Container>
+class shared_secure_buffer {
+public:
+    using container_type = Container;
+    using value_type = typename Container::value_type;
+    using size_type = typename Container::size_type;
+    using const_reference = typename Container::const_reference;
+    using const_pointer = typename Container::const_pointer;
+    using const_iterator = typename Container::const_iterator;
+
+    shared_secure_buffer() = default;
+
+    explicit shared_secure_buffer(Container&& container)
+        : ptr_(std::allocate_shared<Container>(
+                typename std::allocator_traits<typename Container::allocator_type>::template rebind_alloc<Container>(
+                        container.get_allocator()),
+                std::move(container)))
+    {}
+
+    [[nodiscard]] const Container& get() const noexcept { return *ptr_; }
+    [[nodiscard]] const Container& operator*() const noexcept { return *ptr_; }
+    [[nodiscard]] const Container* operator->() const noexcept { return ptr_.get(); }
+
+    [[nodiscard]] const_pointer data() const noexcept { return ptr_ ? ptr_->data() : nullptr; }
+    [[nodiscard]] size_type size() const noexcept { return ptr_ ? ptr_->size() : 0; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    // An empty handle (default-constructed or moved-from) is an empty range
+    [[nodiscard]] const_iterator begin() const noexcept { return ptr_ ? ptr_->begin() : const_iterator{}; }
+    [[nodiscard]] const_iterator end() const noexcept { return ptr_ ? ptr_->end() : const_iterator{}; }
+
+    [[nodiscard]] const_reference operator[](size_type pos) const noexcept { return data()[pos]; }
+
+    [[nodiscard]] long use_count() const noexcept { return ptr_.use_count(); }
+    explicit operator bool() const noexcept { return static_cast<bool>(ptr_); }
+
+    /**
+     * \fn copy
+     * \brief Explicit deep copy for when the contents must be modified
+     */
+    [[nodiscard]] Container copy() const
+    {
+        return ptr_ ? Container::copy(*ptr_) : Container();
+    }
+
+private:
+    std::shared_ptr<const Container> ptr_;
+};
+
+#endif // SHARED_SECURE_BUFFER_H
@@ -1,14 +1,38 @@
 #ifndef VECTOR_SECURE_H
 #define VECTOR_SECURE_H
 
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "growth_policy.h"
 #include "sanitizing_allocator.h"
 
-template <typename T, SanitizingAllocatorDerived Allocator = sanitizing_allocator<T>>
+/**
+ * \class vector_secure
+ * \brief std::vector that wipes its elements when it releases them
+ *
+ * Growth decides how much is reserved when an insertion does not fit, see
+ * growth_policy.h.
+ */
+template <typename T, SanitizingAllocatorDerived Allocator = sanitizing_allocator<T>,
+          GrowthPolicy Growth = standard_growth>
 class vector_secure : public std::vector<T, Allocator> {
 public:
     using std::vector<T, Allocator>::vector;
+    using size_type = typename std::vector<T, Allocator>::size_type;
+
+    explicit vector_secure(size_type count, const Allocator& alloc = Allocator())
+            : std::vector<T, Allocator>(ZEROED_VALUE_INIT ? 0 : count, alloc)
+    {
+        if constexpr (ZEROED_VALUE_INIT)
+            growZeroed(count, count);
+    }
 
     constexpr vector_secure(vector_secure&& other) noexcept
             : std::vector<T, Allocator>(std::move(other))
@@ -24,6 +48,11 @@ public:
         return *this;
     }
 
+    ~vector_secure()
+    {
+        growth_policy_record<Growth>(this->size());
+    }
+
     template<class InputIt>
     [[nodiscard]] static vector_secure copy(InputIt first, InputIt last, const Allocator& alloc = Allocator())
     {
@@ -40,7 +69,168 @@ public:
         return vector_secure(other, alloc);
     }
 
+    /**
+     * \fn copy_range
+     * \brief Copies the elements of a range into a new container with a single
+     * allocation where the size can be known
+     *
+     * The size is taken from ranges::size, or from \p sizeHint, or by walking a
+     * forward range once; only a single-pass range that outgrows the hint
+     * reallocates (and wipes) as it grows.
+     */
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+    [[nodiscard]] static vector_secure copy_range(R&& range, size_type sizeHint = 0, const Allocator& alloc = Allocator())
+    {
+        vector_secure result(alloc);
+        if constexpr (std::ranges::sized_range<R>) {
+            result.reserve(size_type(std::ranges::size(range)));
+        } else if constexpr (std::ranges::forward_range<R>) {
+            result.reserve(sizeHint ? sizeHint : size_type(std::ranges::distance(range)));
+        } else {
+            result.reserve(sizeHint);
+        }
+
+        for (auto&& element : range)
+            result.emplace_back(std::forward<decltype(element)>(element));
+        return result;
+    }
+
+#ifdef __cpp_lib_containers_ranges
+    // Lets std::ranges::to<vector_secure<T>> build the container, which is an
+    // explicit copy just like copy_range
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+    vector_secure(std::from_range_t, R&& range, const Allocator& alloc = Allocator())
+            : vector_secure(copy_range(std::forward<R>(range), 0, alloc))
+    {}
+#endif // __cpp_lib_containers_ranges
+
+    /**
+     * \fn assign_secure
+     * \brief Copies the contents of another container into this one, reusing
+     * the existing capacity when it is large enough
+     *
+     * Unlike `x = vector_secure::copy(y)` no new block is allocated unless the
+     * current one is too small, and the elements dropped from the end are wiped
+     * in place.
+     */
+    void assign_secure(const vector_secure& other)
+    {
+        if (this != &other)
+            assign_secure(other.begin(), other.end());
+    }
+
+    template<class InputIt>
+    void assign_secure(InputIt first, InputIt last)
+    {
+        size_type oldSize = this->size();
+        std::vector<T, Allocator>::assign(first, last);
+        sanitizeTail(oldSize);
+    }
+
+    // Shrinking operations wipe the elements they drop right away instead of
+    // leaving them in the capacity until the block is deallocated.
+
+    void resize(size_type count)
+    {
+        size_type oldSize = this->size();
+
+        if constexpr (ZEROED_VALUE_INIT) {
+            if (count > this->capacity()) {
+                // the new block comes zero-filled from the allocator, so the
+                // appended elements are already value-initialized
+                growZeroed(count, Growth::next_capacity(this->capacity(), count));
+                return;
+            }
+        }
+        if constexpr (!STANDARD_GROWTH)
+            growFor(count);
+        std::vector<T, Allocator>::resize(count);
+        sanitizeTail(oldSize);
+    }
+
+    void resize(size_type count, const T& value)
+    {
+        size_type oldSize = this->size();
+        if constexpr (!STANDARD_GROWTH) {
+            if (count > this->capacity()) {
+                // the value may be an element that is about to be moved
+                T copy(value);
+                growFor(count);
+                std::vector<T, Allocator>::resize(count, copy);
+                return;
+            }
+        }
+        std::vector<T, Allocator>::resize(count, value);
+        sanitizeTail(oldSize);
+    }
+
+    constexpr auto erase(typename std::vector<T, Allocator>::const_iterator pos)
+    {
+        size_type oldSize = this->size();
+        auto it = std::vector<T, Allocator>::erase(pos);
+        sanitizeTail(oldSize);
+        return it;
+    }
+
+    constexpr auto erase(typename std::vector<T, Allocator>::const_iterator first,
+                         typename std::vector<T, Allocator>::const_iterator last)
+    {
+        size_type oldSize = this->size();
+        auto it = std::vector<T, Allocator>::erase(first, last);
+        sanitizeTail(oldSize);
+        return it;
+    }
+
+    constexpr void pop_back()
+    {
+        std::vector<T, Allocator>::pop_back();
+        Allocator::sanitize(this->data() + this->size(), 1);
+    }
+
+    constexpr void clear() noexcept
+    {
+        size_type oldSize = this->size();
+        std::vector<T, Allocator>::clear();
+        sanitizeTail(oldSize);
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if constexpr (!STANDARD_GROWTH) {
+            if (this->size() == this->capacity()) {
+                // the arguments may refer to elements that are about to be moved
+                T value(std::forward<Args>(args)...);
+                growFor(this->size() + 1);
+                return std::vector<T, Allocator>::emplace_back(std::move(value));
+            }
+        }
+        return std::vector<T, Allocator>::emplace_back(std::forward<Args>(args)...);
+    }
+
 protected:
+    /**
+     * Wipes the elements between the current size and \p oldSize, which a
+     * shrinking operation has just dropped.
+     */
+    void sanitizeTail(size_type oldSize) noexcept
+    {
+        if (this->size() < oldSize)
+            Allocator::sanitize(this->data() + this->size(), oldSize - this->size());
+    }
+
     template<class InputIt>
     constexpr vector_secure(InputIt first, InputIt last, const Allocator& alloc = Allocator())
             : std::vector<T, Allocator>(first, last, alloc)
@@ -53,6 +243,61 @@ protected:
     constexpr vector_secure(const vector_secure& other, const Allocator& alloc)
             : std::vector<T, Allocator>(other, alloc)
     {}
+
+private:
+    // std::vector grows the same way on its own
+    static constexpr bool STANDARD_GROWTH = std::is_same_v<Growth, standard_growth>;
+
+    /**
+     * Value-initializing T is the same as zero-filling it, so elements appended
+     * to a zero-filled block do not have to be written.
+     */
+    static constexpr bool ZEROED_VALUE_INIT = Allocator::allocates_zeroed &&
+                                              (std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                                               std::is_pointer_v<T>);
+
+    // Yields zeroed_element, so that a vector built from it leaves its new
+    // block as the allocator returned it
+    struct zeroed_iterator {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = zeroed_element_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = zeroed_element_t;
+
+        zeroed_element_t operator*() const noexcept { return zeroed_element; }
+        zeroed_iterator& operator++() noexcept { ++pos; return *this; }
+        zeroed_iterator operator++(int) noexcept { return { pos++ }; }
+        bool operator==(const zeroed_iterator&) const = default;
+
+        size_type pos;
+    };
+
+    /**
+     * Moves the elements to a new zero-filled block of \p capacity elements
+     * and extends the size to \p count without writing the new elements.
+     */
+    void growZeroed(size_type count, size_type capacity)
+    {
+        std::vector<T, Allocator> grown(zeroed_iterator{ 0 }, zeroed_iterator{ capacity }, this->get_allocator());
+        std::copy(this->begin(), this->end(), grown.begin());
+        // dropping trivially destructible elements writes nothing
+        grown.resize(count);
+        std::vector<T, Allocator>::swap(grown);
+    }
+
+    // Reserves what the growth policy asks for if \p required does not fit
+    void growFor(size_type required)
+    {
+        if (required > this->capacity())
+            this->reserve(Growth::next_capacity(this->capacity(), required));
+    }
 };
 
+template <typename T, typename Allocator, typename Growth>
+void copy_into(vector_secure<T, Allocator, Growth>& dst, const vector_secure<T, Allocator, Growth>& src)
+{
+    dst.assign_secure(src);
+}
+
 #endif // VECTOR_SECURE_H
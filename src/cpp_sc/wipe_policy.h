@@ -0,0 +1,196 @@
+#ifndef WIPE_POLICY_H
+#define WIPE_POLICY_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "platform.h"
+
+/**
+ * Wipe policies tell sanitizing_allocator_base how to wipe a block before it
+ * is released. A policy is a stateless type with
+ *
+ *     template <typename T> static void wipe(T* p, size_t n) noexcept;
+ *
+ * which receives the element type and element count, and is defined inline:
+ * with the count known at the call site (e.g. a single object) the compiler
+ * reduces the wipe to a few stores. A policy that leaves the block zero-filled
+ * says so with `static constexpr bool zero_fills = true`; backends then reuse
+ * such blocks without clearing them.
+ */
+template <typename P>
+concept WipePolicy = std::is_empty_v<P> && requires(unsigned char* p, size_t n) {
+    { P::template wipe<unsigned char>(p, n) } noexcept;
+};
+
+template <WipePolicy P>
+constexpr bool wipe_policy_zero_fills = [] {
+    if constexpr (requires { P::zero_fills; })
+        return bool(P::zero_fills);
+    else
+        return false;
+}();
+
+namespace detail {
+
+inline void fill_bytes(void* p, int value, size_t size) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    std::memset(p, value, size);
+    asm volatile("" : : "r"(p) : "memory");
+#else
+    volatile unsigned char* bytes = static_cast<volatile unsigned char*>(p);
+    while (size--) *bytes++ = static_cast<unsigned char>(value);
+#endif
+}
+
+} // namespace detail
+
+
+/**
+ * Zero-fills the block; the default. Inline equivalent of burn().
+ */
+struct zero_fill {
+    static constexpr bool zero_fills = true;
+
+    template <typename T>
+    static void wipe(T* p, size_t n) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        detail::fill_bytes(static_cast<void*>(p), 0, n * sizeof(T));
+#else
+        burn(static_cast<void*>(p), n * sizeof(T));
+#endif
+    }
+};
+
+/**
+ * Fills the block with a fixed byte, e.g. to make use-after-free reads of
+ * wiped memory recognizable.
+ */
+template <unsigned char Byte>
+struct pattern_fill {
+    static constexpr bool zero_fills = Byte == 0;
+
+    template <typename T>
+    static void wipe(T* p, size_t n) noexcept
+    {
+        detail::fill_bytes(static_cast<void*>(p), Byte, n * sizeof(T));
+    }
+};
+
+/**
+ * Wipes the block with Inner, then writes the wiped cache lines back to memory
+ * and evicts them (see flush_cache()), so no copy of the secret stays in the
+ * CPU caches or write buffers. Zero fills go through burn_and_flush(), which
+ * evicts each page right after clearing it.
+ */
+template <WipePolicy Inner = zero_fill>
+struct wipe_and_flush {
+    static constexpr bool zero_fills = wipe_policy_zero_fills<Inner>;
+
+    template <typename T>
+    static void wipe(T* p, size_t n) noexcept
+    {
+        if constexpr (std::is_same_v<Inner, zero_fill>) {
+            burn_and_flush(static_cast<void*>(p), n * sizeof(T));
+        } else {
+            Inner::template wipe<T>(p, n);
+            flush_cache(static_cast<void*>(p), n * sizeof(T));
+        }
+    }
+};
+
+/**
+ * Wipes the block with Inner, then writes the wiped cache lines back to memory
+ * (see write_back_cache()). Cheaper than wipe_and_flush where clwb is
+ * available: the zeroed lines may stay cached.
+ */
+template <WipePolicy Inner = zero_fill>
+struct wipe_and_write_back {
+    static constexpr bool zero_fills = wipe_policy_zero_fills<Inner>;
+
+    template <typename T>
+    static void wipe(T* p, size_t n) noexcept
+    {
+        Inner::template wipe<T>(p, n);
+        write_back_cache(static_cast<void*>(p), n * sizeof(T));
+    }
+};
+
+/**
+ * Wipes blocks smaller than Bytes with Small and the others with Large.
+ */
+template <size_t Bytes, WipePolicy Small, WipePolicy Large>
+struct switch_at {
+    static constexpr bool zero_fills = wipe_policy_zero_fills<Small> && wipe_policy_zero_fills<Large>;
+
+    template <typename T>
+    static void wipe(T* p, size_t n) noexcept
+    {
+        if (n * sizeof(T) < Bytes)
+            Small::template wipe<T>(p, n);
+        else
+            Large::template wipe<T>(p, n);
+    }
+};
+
+/**
+ * Leaves the block as it is. Only meant for measuring the cost of wiping.
+ */
+struct no_wipe {
+    template <typename T>
+    static void wipe(T*, size_t) noexcept
+    {}
+};
+
+/**
+ * Adapts an out-of-line cleanse function `void(void*, size_t)` (the original
+ * form of the sanitizing_allocator_base parameter) to a policy. Nothing is
+ * known about what an arbitrary function leaves behind, so only &burn counts
+ * as zero-filling.
+ */
+template <auto Func>
+    requires std::invocable<decltype(Func), void*, size_t>
+struct cleanse_with {
+    template <typename T>
+    static void wipe(T* p, size_t n) noexcept
+    {
+        Func(static_cast<void*>(p), n * sizeof(T));
+    }
+};
+
+// Matched as a template argument rather than by comparing addresses, which is
+// not a constant expression for every function (e.g. under -fsanitize=undefined)
+template <>
+struct cleanse_with<&burn> {
+    static constexpr bool zero_fills = true;
+
+    template <typename T>
+    static void wipe(T* p, size_t n) noexcept
+    {
+        burn(static_cast<void*>(p), n * sizeof(T));
+    }
+};
+
+/**
+ * Policy type for the Wipe parameter of sanitizing_allocator_base, which takes
+ * either a policy object (`zero_fill{}`) or a cleanse function pointer.
+ */
+template <auto Wipe>
+struct wipe_policy_for {
+    using type = decltype(Wipe);
+};
+
+template <auto Wipe>
+    requires std::is_pointer_v<decltype(Wipe)>
+struct wipe_policy_for<Wipe> {
+    using type = cleanse_with<Wipe>;
+};
+
+template <auto Wipe>
+using wipe_policy_t = typename wipe_policy_for<Wipe>::type;
+
+#endif // WIPE_POLICY_H
@@ -0,0 +1,233 @@
+#include "parallel_burn.h"
+#include "platform.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace {
+
+constexpr size_t CACHE_LINE = 64;
+constexpr unsigned MAX_WORKERS = 15;
+
+static_assert(PARALLEL_WIPE_CHUNK % CACHE_LINE == 0, "Wipe chunks must be whole cache lines");
+
+std::atomic<size_t> threshold = PARALLEL_WIPE_THRESHOLD;
+std::atomic<unsigned> workerCount = [] {
+    unsigned cores = std::thread::hardware_concurrency();
+    return cores > 1 ? cores - 1 : 0u;
+}();
+std::atomic<bool> forked = false;
+
+// Chunk indices [begin, end) packed into one word, so that the owner taking
+// from the front and thieves taking from the back agree with a single CAS.
+struct alignas(CACHE_LINE) chunk_range {
+    std::atomic<uint64_t> packed = 0;
+};
+
+uint64_t pack(uint32_t begin, uint32_t end) noexcept
+{
+    return (uint64_t(begin) << 32) | end;
+}
+
+uint32_t rangeBegin(uint64_t packed) noexcept
+{
+    return uint32_t(packed >> 32);
+}
+
+uint32_t rangeEnd(uint64_t packed) noexcept
+{
+    return uint32_t(packed);
+}
+
+class wipe_pool {
+public:
+    /**
+     * Returns false without touching the buffer if another wipe is running or
+     * no worker could be started.
+     */
+    bool wipe(void* ptr, size_t size) noexcept
+    {
+        std::unique_lock lock(mutex_, std::try_to_lock);
+        if (!lock.owns_lock())
+            return false;
+
+        unsigned workers = std::min(workerCount.load(std::memory_order_relaxed), MAX_WORKERS);
+        startWorkers(workers);
+        workers = std::min(workers, started_);
+        if (workers == 0)
+            return false;
+
+        begin_ = reinterpret_cast<uintptr_t>(ptr);
+        end_ = begin_ + size;
+        base_ = begin_ & ~uintptr_t(CACHE_LINE - 1);
+
+        uint64_t chunks = (end_ - base_ + PARALLEL_WIPE_CHUNK - 1) / PARALLEL_WIPE_CHUNK;
+        if (chunks > UINT32_MAX)
+            return false;
+
+        participants_ = workers + 1;
+        for (unsigned i = 0; i < participants_; ++i) {
+            auto first = uint32_t(chunks * i / participants_);
+            auto last = uint32_t(chunks * (i + 1) / participants_);
+            ranges_[i].packed.store(pack(first, last), std::memory_order_relaxed);
+        }
+
+        busy_.store(started_, std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_release);
+        generation_.notify_all();
+
+        work(0);
+
+        for (unsigned left = busy_.load(std::memory_order_acquire); left != 0;
+             left = busy_.load(std::memory_order_acquire))
+            busy_.wait(left, std::memory_order_acquire);
+        return true;
+    }
+
+private:
+    void startWorkers(unsigned count) noexcept
+    {
+        try {
+            uint64_t current = generation_.load(std::memory_order_relaxed);
+            for (; started_ < count; ++started_)
+                std::thread(&wipe_pool::workerLoop, this, started_ + 1, current).detach();
+        } catch (...) {
+            // Go on with the workers that did start
+        }
+    }
+
+    // Every started worker takes part in each generation exactly once, those
+    // above the current participant count only to check in.
+    [[noreturn]] void workerLoop(unsigned index, uint64_t seen) noexcept
+    {
+        for (;;) {
+            generation_.wait(seen, std::memory_order_acquire);
+            seen = generation_.load(std::memory_order_acquire);
+
+            if (index < participants_)
+                work(index);
+
+            busy_.fetch_sub(1, std::memory_order_release);
+            busy_.notify_one();
+        }
+    }
+
+    void work(unsigned self) noexcept
+    {
+        for (;;) {
+            uint32_t chunk;
+            if (takeOwn(self, chunk) || steal(self, chunk))
+                wipeChunk(chunk);
+            else
+                return;
+        }
+    }
+
+    bool takeOwn(unsigned self, uint32_t& chunk) noexcept
+    {
+        std::atomic<uint64_t>& range = ranges_[self].packed;
+        uint64_t current = range.load(std::memory_order_relaxed);
+        while (rangeBegin(current) < rangeEnd(current)) {
+            if (range.compare_exchange_weak(current, pack(rangeBegin(current) + 1, rangeEnd(current)),
+                                            std::memory_order_relaxed)) {
+                chunk = rangeBegin(current);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Takes the back half of another participant's share and makes it our own.
+    bool steal(unsigned self, uint32_t& chunk) noexcept
+    {
+        for (unsigned offset = 1; offset < participants_; ++offset) {
+            std::atomic<uint64_t>& victim = ranges_[(self + offset) % participants_].packed;
+            uint64_t current = victim.load(std::memory_order_relaxed);
+            while (rangeBegin(current) < rangeEnd(current)) {
+                uint32_t first = rangeBegin(current);
+                uint32_t last = rangeEnd(current);
+                uint32_t split = last - (last - first + 1) / 2;
+                if (victim.compare_exchange_weak(current, pack(first, split), std::memory_order_relaxed)) {
+                    chunk = split;
+                    ranges_[self].packed.store(pack(split + 1, last), std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void wipeChunk(uint32_t chunk) noexcept
+    {
+        uintptr_t first = std::max(base_ + uintptr_t(chunk) * PARALLEL_WIPE_CHUNK, begin_);
+        uintptr_t last = std::min(base_ + uintptr_t(chunk + 1) * PARALLEL_WIPE_CHUNK, end_);
+        burn(reinterpret_cast<void*>(first), last - first);
+    }
+
+    std::mutex mutex_;
+    unsigned started_ = 0;
+    unsigned participants_ = 0;
+    uintptr_t begin_ = 0;
+    uintptr_t end_ = 0;
+    uintptr_t base_ = 0;
+    chunk_range ranges_[MAX_WORKERS + 1];
+
+    alignas(CACHE_LINE) std::atomic<uint64_t> generation_ = 0;
+    alignas(CACHE_LINE) std::atomic<unsigned> busy_ = 0;
+};
+
+// The pool is never destroyed: sanitizing containers with static storage
+// duration may still be released after it during exit.
+wipe_pool* pool() noexcept
+{
+    static wipe_pool* instance = [] {
+#if defined(__unix__) || defined(__APPLE__)
+        // Worker threads do not survive fork(); the child wipes alone
+        pthread_atfork(nullptr, nullptr, [] { forked.store(true, std::memory_order_relaxed); });
+#endif
+        return new (std::nothrow) wipe_pool();
+    }();
+    return instance;
+}
+
+} // namespace
+
+void parallel_burn(void* ptr, size_t size) noexcept
+{
+    if (size >= threshold.load(std::memory_order_relaxed) && !forked.load(std::memory_order_relaxed)) {
+        if (workerCount.load(std::memory_order_relaxed) != 0) {
+            wipe_pool* p = pool();
+            if (p && p->wipe(ptr, size))
+                return;
+        }
+    }
+    burn(ptr, size);
+}
+
+size_t parallel_wipe_threshold() noexcept
+{
+    return threshold.load(std::memory_order_relaxed);
+}
+
+void set_parallel_wipe_threshold(size_t bytes) noexcept
+{
+    threshold.store(bytes, std::memory_order_relaxed);
+}
+
+unsigned parallel_wipe_workers() noexcept
+{
+    return workerCount.load(std::memory_order_relaxed);
+}
+
+void set_parallel_wipe_workers(unsigned count) noexcept
+{
+    workerCount.store(count, std::memory_order_relaxed);
+}
@@ -0,0 +1,33 @@
+#ifndef PARALLEL_BURN_H
+#define PARALLEL_BURN_H
+
+#include <cstddef>
+
+constexpr size_t PARALLEL_WIPE_THRESHOLD = 64 * 1024 * 1024;
+constexpr size_t PARALLEL_WIPE_CHUNK = 256 * 1024;
+
+/**
+ * Wipes a buffer like burn(), splitting buffers of at least
+ * parallel_wipe_threshold() bytes across a small process-wide worker pool.
+ * The buffer is cut into cache-line aligned chunks of PARALLEL_WIPE_CHUNK
+ * bytes; every participant (the caller included) starts on its own share and
+ * steals from the others once it runs dry. Returns only when every chunk has
+ * been wiped. If the pool is busy with another wipe, or it has no workers,
+ * the caller wipes the buffer alone.
+ *
+ * Has the signature of a cleanse function, see parallel_sanitizing_allocator.
+ */
+void parallel_burn(void* ptr, size_t size) noexcept;
+
+size_t parallel_wipe_threshold() noexcept;
+void set_parallel_wipe_threshold(size_t bytes) noexcept;
+
+/**
+ * Number of worker threads helping the caller; one less than the number of
+ * cores by default. Workers are started on first need and never stopped, a
+ * lower count only leaves some of them idle.
+ */
+unsigned parallel_wipe_workers() noexcept;
+void set_parallel_wipe_workers(unsigned count) noexcept;
+
+#endif // PARALLEL_BURN_H
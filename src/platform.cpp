@@ -9,10 +9,38 @@
 #endif
 
 
+#include <cstdint>
+#include <cstring>
+
 #if defined(__WINDOWS_API__)
 #include <windows.h>
+#include <bcrypt.h>
 #elif (defined(__LINUX_API__) || defined(__MAC_OS_API__))
-#include <cstring>
+#include <cerrno>
+#include <sys/mman.h>
+#include <sys/random.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define __X86_CPU__
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define __TARGET(features)
+#else
+#include <cpuid.h>
+#define __TARGET(features) __attribute__((target(features)))
+#endif
+#endif
+
+#if defined(__LINUX_API__)
+#include <sys/syscall.h>
+
+#ifndef SYS_memfd_secret
+#define SYS_memfd_secret 447
+#endif
 #endif
 
 void burn(void* ptr, size_t size) noexcept
@@ -31,3 +59,369 @@ void burn(void* ptr, size_t size) noexcept
     while (len--) *p++ = 0;
 #endif
 }
+
+#if defined(__X86_CPU__)
+namespace {
+
+constexpr uintptr_t CACHE_LINE = 64;
+
+// cpuid feature bits: leaf 1 edx, leaf 7 ebx
+constexpr unsigned CPUID_CLFSH = 1u << 19;
+constexpr unsigned CPUID_CLFLUSHOPT = 1u << 23;
+constexpr unsigned CPUID_CLWB = 1u << 24;
+
+// Line loops over [line, end) without the closing fence, so that a caller can
+// issue many of them and order them all with a single fence.
+using lines_func = void (*)(uintptr_t line, uintptr_t end) noexcept;
+
+void clflushLines(uintptr_t line, uintptr_t end) noexcept
+{
+    for (; line < end; line += CACHE_LINE)
+        _mm_clflush(reinterpret_cast<const void*>(line));
+}
+
+__TARGET("clflushopt") void clflushoptLines(uintptr_t line, uintptr_t end) noexcept
+{
+    for (; line < end; line += CACHE_LINE)
+        _mm_clflushopt(reinterpret_cast<void*>(line));
+}
+
+__TARGET("clwb") void clwbLines(uintptr_t line, uintptr_t end) noexcept
+{
+    for (; line < end; line += CACHE_LINE)
+        _mm_clwb(reinterpret_cast<void*>(line));
+}
+
+struct cache_ops {
+    cache_flush_instruction evictWith = cache_flush_instruction::none;
+    cache_flush_instruction writeBackWith = cache_flush_instruction::none;
+    lines_func evict = nullptr;
+    lines_func writeBack = nullptr;
+};
+
+const cache_ops& cacheOps() noexcept
+{
+    static const cache_ops ops = [] {
+        bool clflush = false, clflushopt = false, clwb = false;
+#if defined(_MSC_VER)
+        int regs[4];
+        __cpuid(regs, 0);
+        int maxLeaf = regs[0];
+        __cpuid(regs, 1);
+        clflush = unsigned(regs[3]) & CPUID_CLFSH;
+        if (maxLeaf >= 7) {
+            __cpuidex(regs, 7, 0);
+            clflushopt = unsigned(regs[1]) & CPUID_CLFLUSHOPT;
+            clwb = unsigned(regs[1]) & CPUID_CLWB;
+        }
+#else
+        unsigned eax, ebx, ecx, edx;
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+            clflush = edx & CPUID_CLFSH;
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+            clflushopt = ebx & CPUID_CLFLUSHOPT;
+            clwb = ebx & CPUID_CLWB;
+        }
+#endif
+
+        cache_ops result;
+        if (clflushopt) {
+            result.evictWith = cache_flush_instruction::clflushopt;
+            result.evict = &clflushoptLines;
+        } else if (clflush) {
+            result.evictWith = cache_flush_instruction::clflush;
+            result.evict = &clflushLines;
+        }
+
+        if (clwb) {
+            result.writeBackWith = cache_flush_instruction::clwb;
+            result.writeBack = &clwbLines;
+        } else {
+            result.writeBackWith = result.evictWith;
+            result.writeBack = result.evict;
+        }
+        return result;
+    }();
+    return ops;
+}
+
+uintptr_t lineOf(const void* ptr) noexcept
+{
+    return reinterpret_cast<uintptr_t>(ptr) & ~(CACHE_LINE - 1);
+}
+
+uintptr_t endOf(const void* ptr, size_t size) noexcept
+{
+    return reinterpret_cast<uintptr_t>(ptr) + size;
+}
+
+// clflush is ordered against every store, only a full fence waits for it;
+// clflushopt and clwb are ordered by sfence.
+void fenceAfter(cache_flush_instruction used) noexcept
+{
+    if (used == cache_flush_instruction::clflush)
+        _mm_mfence();
+    else
+        _mm_sfence();
+}
+
+} // namespace
+#endif // __X86_CPU__
+
+cache_flush_instruction cache_evict_instruction() noexcept
+{
+#if defined(__X86_CPU__)
+    return cacheOps().evictWith;
+#else
+    return cache_flush_instruction::none;
+#endif
+}
+
+cache_flush_instruction cache_write_back_instruction() noexcept
+{
+#if defined(__X86_CPU__)
+    return cacheOps().writeBackWith;
+#else
+    return cache_flush_instruction::none;
+#endif
+}
+
+void flush_cache(const void* ptr, size_t size) noexcept
+{
+#if defined(__X86_CPU__)
+    const cache_ops& ops = cacheOps();
+    if (!ops.evict || size == 0)
+        return;
+
+    ops.evict(lineOf(ptr), endOf(ptr, size));
+    fenceAfter(ops.evictWith);
+
+#else
+    (void)ptr;
+    (void)size;
+#endif
+}
+
+void write_back_cache(const void* ptr, size_t size) noexcept
+{
+#if defined(__X86_CPU__)
+    const cache_ops& ops = cacheOps();
+    if (!ops.writeBack || size == 0)
+        return;
+
+    ops.writeBack(lineOf(ptr), endOf(ptr, size));
+    fenceAfter(ops.writeBackWith);
+
+#else
+    (void)ptr;
+    (void)size;
+#endif
+}
+
+void burn_and_flush(void* ptr, size_t size) noexcept
+{
+#if defined(__X86_CPU__)
+    const cache_ops& ops = cacheOps();
+    if (!ops.evict || size == 0) {
+        burn(ptr, size);
+        return;
+    }
+
+    // Evict each block right after zeroing it, while its lines are still in
+    // L1, and order all the evictions with one fence at the end.
+    constexpr uintptr_t BLOCK = 4096;
+    auto* bytes = static_cast<unsigned char*>(ptr);
+    uintptr_t end = endOf(ptr, size);
+    for (uintptr_t begin = reinterpret_cast<uintptr_t>(ptr); begin < end;) {
+        uintptr_t next = (begin & ~(BLOCK - 1)) + BLOCK;
+        if (next > end)
+            next = end;
+
+        burn(bytes + (begin - reinterpret_cast<uintptr_t>(ptr)), next - begin);
+        ops.evict(begin & ~(CACHE_LINE - 1), next);
+        begin = next;
+    }
+    fenceAfter(ops.evictWith);
+
+#else
+    burn(ptr, size);
+#endif
+}
+
+size_t page_size() noexcept
+{
+#if defined(__WINDOWS_API__)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+
+#elif (defined(__LINUX_API__) || defined(__MAC_OS_API__))
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+
+#else
+    return 4096;
+#endif
+}
+
+void* map_pages(size_t size) noexcept
+{
+#if defined(__WINDOWS_API__)
+    return VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+
+#elif (defined(__LINUX_API__) || defined(__MAC_OS_API__))
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+
+#else
+    return nullptr;
+#endif
+}
+
+void unmap_pages(void* ptr, size_t size) noexcept
+{
+#if defined(__WINDOWS_API__)
+    (void)size;
+    VirtualFree(ptr, 0, MEM_RELEASE);
+
+#elif (defined(__LINUX_API__) || defined(__MAC_OS_API__))
+    munmap(ptr, size);
+
+#else
+    (void)ptr;
+    (void)size;
+#endif
+}
+
+void* remap_pages(void* ptr, size_t oldSize, size_t newSize) noexcept
+{
+#if defined(__LINUX_API__)
+    void* moved = mremap(ptr, oldSize, newSize, MREMAP_MAYMOVE);
+    return moved == MAP_FAILED ? nullptr : moved;
+
+#else
+    void* moved = map_pages(newSize);
+    if (moved) {
+        memcpy(moved, ptr, oldSize < newSize ? oldSize : newSize);
+        burn(ptr, oldSize);
+        unmap_pages(ptr, oldSize);
+    }
+    return moved;
+#endif
+}
+
+bool discard_pages(void* ptr, size_t size) noexcept
+{
+#if defined(__LINUX_API__)
+    auto begin = reinterpret_cast<uintptr_t>(ptr);
+    auto end = begin + size;
+    uintptr_t page = page_size();
+    uintptr_t alignedBegin = (begin + page - 1) & ~(page - 1);
+    uintptr_t alignedEnd = end & ~(page - 1);
+
+    if (alignedBegin >= alignedEnd)
+        return false;
+
+    // MADV_DONTNEED fails on locked pages; the caller has to burn() them then
+    if (madvise(reinterpret_cast<void*>(alignedBegin), alignedEnd - alignedBegin, MADV_DONTNEED) != 0)
+        return false;
+
+    burn(ptr, alignedBegin - begin);
+    burn(reinterpret_cast<void*>(alignedEnd), end - alignedEnd);
+    return true;
+
+#else
+    (void)ptr;
+    (void)size;
+    return false;
+#endif
+}
+
+void* map_secret_pages(size_t size) noexcept
+{
+#if defined(__LINUX_API__)
+    int fd = static_cast<int>(syscall(SYS_memfd_secret, 0));
+    if (fd < 0)
+        return nullptr;
+
+    void* ptr = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(size)) == 0)
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+
+    // The mapping is shared: a forked child must not get write access to it
+    madvise(ptr, size, MADV_DONTFORK);
+    return ptr;
+
+#else
+    (void)size;
+    return nullptr;
+#endif
+}
+
+bool lock_pages(void* ptr, size_t size) noexcept
+{
+#if defined(__WINDOWS_API__)
+    return VirtualLock(ptr, size) != 0;
+
+#elif (defined(__LINUX_API__) || defined(__MAC_OS_API__))
+    return mlock(ptr, size) == 0;
+
+#else
+    (void)ptr;
+    (void)size;
+    return false;
+#endif
+}
+
+bool wipe_pages_on_fork(void* ptr, size_t size) noexcept
+{
+#if defined(__LINUX_API__) && defined(MADV_WIPEONFORK)
+    return madvise(ptr, size, MADV_WIPEONFORK) == 0;
+
+#else
+    (void)ptr;
+    (void)size;
+    return false;
+#endif
+}
+
+bool system_random(void* ptr, size_t size) noexcept
+{
+#if defined(__WINDOWS_API__)
+    return BCRYPT_SUCCESS(BCryptGenRandom(nullptr, static_cast<PUCHAR>(ptr), static_cast<ULONG>(size),
+                                          BCRYPT_USE_SYSTEM_PREFERRED_RNG));
+
+#elif defined(__LINUX_API__)
+    auto* bytes = static_cast<unsigned char*>(ptr);
+    while (size) {
+        ssize_t n = getrandom(bytes, size, 0);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        bytes += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+
+#elif defined(__MAC_OS_API__)
+    auto* bytes = static_cast<unsigned char*>(ptr);
+    while (size) {
+        size_t n = size < 256 ? size : 256;
+        if (getentropy(bytes, n) != 0)
+            return false;
+        bytes += n;
+        size -= n;
+    }
+    return true;
+
+#else
+    (void)ptr;
+    (void)size;
+    return false;
+#endif
+}
@@ -1,8 +1,96 @@
 #ifndef PLATFORM_H
 #define PLATFORM_H
 
+#include <cstddef>
 #include <cstdint>
 
 void burn(void* ptr, size_t size) noexcept;
 
+/**
+ * Stack scrubbing (see scoped_stack_scrub). burn_stack zeroes the \p depth
+ * bytes of unused stack below the caller. paint_stack writes a canary word
+ * every STACK_CANARY_STRIDE bytes over the \p depth bytes below the caller
+ * and returns the top of the painted span. scrub_painted_stack later finds
+ * the deepest canary that was overwritten, zeroes the stack from there (less
+ * STACK_SCRUB_MARGIN) up to the caller and returns the number of bytes wiped.
+ * Written bytes that fall between canaries are covered by the margin.
+ */
+constexpr size_t STACK_CANARY_STRIDE = 256;
+constexpr size_t STACK_SCRUB_MARGIN = 512;
+
+void burn_stack(size_t depth) noexcept;
+void* paint_stack(size_t depth) noexcept;
+size_t scrub_painted_stack(void* top, size_t depth) noexcept;
+
+/**
+ * Cache line flushing, with the instruction picked once at runtime from cpuid.
+ *
+ * flush_cache writes the lines covering a buffer back to memory and evicts
+ * them from every cache level (clflushopt, or clflush on older CPUs).
+ * write_back_cache only writes them back and may keep them cached (clwb,
+ * falling back to eviction). burn_and_flush zeroes a buffer and evicts it,
+ * interleaving the stores with the flushes. All of them issue the flushes
+ * back to back and wait for them with a single fence at the end. Without a
+ * flush instruction the flushing is a no-op.
+ */
+enum class cache_flush_instruction {
+    none,
+    clflush,
+    clflushopt,
+    clwb
+};
+
+cache_flush_instruction cache_evict_instruction() noexcept;
+cache_flush_instruction cache_write_back_instruction() noexcept;
+void flush_cache(const void* ptr, size_t size) noexcept;
+void write_back_cache(const void* ptr, size_t size) noexcept;
+void burn_and_flush(void* ptr, size_t size) noexcept;
+
+/**
+ * Page-granular anonymous mappings. Sizes must be multiples of page_size().
+ * Freshly mapped pages are zero-filled by the OS. remap_pages moves the pages
+ * of an existing mapping to a mapping of newSize bytes (mremap on Linux), so
+ * the old range holds no copy of the data afterwards; it returns nullptr and
+ * leaves the mapping untouched on failure.
+ */
+size_t page_size() noexcept;
+void* map_pages(size_t size) noexcept;
+void* remap_pages(void* ptr, size_t oldSize, size_t newSize) noexcept;
+void unmap_pages(void* ptr, size_t size) noexcept;
+
+/**
+ * Wipes a buffer by letting the kernel drop its whole pages (MADV_DONTNEED);
+ * they read back as zero. Only the unaligned head and tail are written. Must
+ * only be used on private anonymous memory. Returns false without touching
+ * the buffer if the pages cannot be dropped (locked pages, unsupported
+ * platform, no whole page in the range); burn() it then.
+ */
+bool discard_pages(void* ptr, size_t size) noexcept;
+
+/**
+ * Maps pages from a memfd_secret() file (Linux 5.14+): they are removed from
+ * the kernel direct map and cannot be swapped. Returns nullptr if the syscall
+ * is unavailable or disabled. The mapping is not inherited by fork()ed
+ * children. It is released with unmap_pages().
+ */
+void* map_secret_pages(size_t size) noexcept;
+
+/**
+ * Pins pages in RAM (mlock / VirtualLock). Returns false on failure, e.g. when
+ * RLIMIT_MEMLOCK is exceeded.
+ */
+bool lock_pages(void* ptr, size_t size) noexcept;
+
+/**
+ * Makes fork()ed children see the pages zero-filled (MADV_WIPEONFORK, Linux
+ * 4.14+). Returns false where this is not supported.
+ */
+bool wipe_pages_on_fork(void* ptr, size_t size) noexcept;
+
+/**
+ * Fills a buffer from the OS entropy source (getrandom, getentropy or
+ * BCryptGenRandom). Returns false if the source failed.
+ */
+bool system_random(void* ptr, size_t size) noexcept;
+
 #endif // PLATFORM_H
@@ -0,0 +1,164 @@
+#include "random_engine.h"
+#include "chacha20.h"
+#include "platform.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace {
+
+constexpr size_t BUFFER_SIZE = 512;
+constexpr uint8_t ZERO_NONCE[CHACHA20_NONCE_SIZE] = {};
+
+static_assert(BUFFER_SIZE % CHACHA20_BLOCK_SIZE == 0, "Keystream buffer must hold whole blocks");
+
+// Incremented in every fork()ed child; covers systems without MADV_WIPEONFORK
+std::atomic<uint64_t> forkGeneration = 1;
+
+struct drbg_state {
+    uint64_t forkGeneration;    // zero (never seeded) in a child under MADV_WIPEONFORK
+    size_t sinceReseed;
+    size_t available;           // unread bytes at the end of buffer
+    uint8_t key[CHACHA20_KEY_SIZE];
+    uint8_t buffer[BUFFER_SIZE];
+};
+
+size_t stateMappingSize() noexcept
+{
+    size_t page = page_size();
+    return (sizeof(drbg_state) + page - 1) / page * page;
+}
+
+class state_holder {
+public:
+    state_holder() = default;
+    state_holder(const state_holder&) = delete;
+    state_holder& operator=(const state_holder&) = delete;
+
+    ~state_holder()
+    {
+        if (state_) {
+            burn(state_, sizeof(drbg_state));
+            unmap_pages(state_, stateMappingSize());
+        }
+    }
+
+    drbg_state& get()
+    {
+        if (!state_) {
+            void* mapping = map_pages(stateMappingSize());
+            if (!mapping)
+                throw std::bad_alloc();
+
+            lock_pages(mapping, stateMappingSize());
+            wipe_pages_on_fork(mapping, stateMappingSize());
+            state_ = static_cast<drbg_state*>(mapping);
+            registerForkHandler();
+        }
+        return *state_;
+    }
+
+private:
+    static void registerForkHandler() noexcept
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        static const bool registered = [] {
+            pthread_atfork(nullptr, nullptr, [] { forkGeneration.fetch_add(1, std::memory_order_relaxed); });
+            return true;
+        }();
+        (void)registered;
+#endif
+    }
+
+    drbg_state* state_ = nullptr;
+};
+
+thread_local state_holder holder;
+
+void reseed(drbg_state& s)
+{
+    uint8_t seed[CHACHA20_KEY_SIZE];
+    if (!system_random(seed, sizeof(seed)))
+        throw std::system_error(errno, std::generic_category(), "system_random");
+
+    // A child keeps the parent's key until now; mixing instead of replacing
+    // never loses entropy the state already had
+    for (size_t i = 0; i < CHACHA20_KEY_SIZE; ++i)
+        s.key[i] ^= seed[i];
+    burn(seed, sizeof(seed));
+
+    burn(s.buffer, sizeof(s.buffer));
+    s.available = 0;
+    s.sinceReseed = 0;
+    s.forkGeneration = forkGeneration.load(std::memory_order_relaxed);
+}
+
+// Fast key erasure: the first bytes of the keystream replace the key.
+void refill(drbg_state& s) noexcept
+{
+    chacha20_keystream(s.key, ZERO_NONCE, 0, s.buffer, BUFFER_SIZE);
+    std::memcpy(s.key, s.buffer, CHACHA20_KEY_SIZE);
+    burn(s.buffer, CHACHA20_KEY_SIZE);
+    s.available = BUFFER_SIZE - CHACHA20_KEY_SIZE;
+}
+
+void take(drbg_state& s, uint8_t*& out, size_t& size) noexcept
+{
+    size_t n = size < s.available ? size : s.available;
+    uint8_t* from = s.buffer + BUFFER_SIZE - s.available;
+    std::memcpy(out, from, n);
+    burn(from, n);
+
+    s.available -= n;
+    s.sinceReseed += n;
+    out += n;
+    size -= n;
+}
+
+// Block 0 of the current key becomes the next key, blocks from 1 on go
+// straight to the output.
+void generateDirect(drbg_state& s, uint8_t* out, size_t size) noexcept
+{
+    uint8_t next[CHACHA20_KEY_SIZE];
+    chacha20_keystream(s.key, ZERO_NONCE, 0, next, sizeof(next));
+    chacha20_keystream(s.key, ZERO_NONCE, 1, out, size);
+    std::memcpy(s.key, next, sizeof(next));
+    burn(next, sizeof(next));
+
+    s.sinceReseed += size;
+}
+
+} // namespace
+
+void secure_random_bytes(void* out, size_t size)
+{
+    drbg_state& s = holder.get();
+    auto* bytes = static_cast<uint8_t*>(out);
+
+    while (size) {
+        if (s.forkGeneration != forkGeneration.load(std::memory_order_relaxed) ||
+            s.sinceReseed >= RANDOM_RESEED_INTERVAL)
+            reseed(s);
+
+        if (s.available) {
+            take(s, bytes, size);
+        } else if (size >= BUFFER_SIZE) {
+            size_t n = size;
+            if (n > RANDOM_RESEED_INTERVAL - s.sinceReseed)
+                n = RANDOM_RESEED_INTERVAL - s.sinceReseed;
+            generateDirect(s, bytes, n);
+            bytes += n;
+            size -= n;
+        } else {
+            refill(s);
+        }
+    }
+}
@@ -0,0 +1,23 @@
+#ifndef RANDOM_ENGINE_H
+#define RANDOM_ENGINE_H
+
+#include <cstddef>
+
+constexpr size_t RANDOM_RESEED_INTERVAL = 16 * 1024 * 1024;
+
+/**
+ * Per-thread ChaCha20 DRBG with fast key erasure. Each thread keeps a key and
+ * a small keystream buffer in a page of its own, which is locked in RAM where
+ * allowed, zero-filled in fork()ed children and wiped when the thread exits.
+ * Every refill derives the next key from the keystream first, so earlier
+ * output cannot be reconstructed from the state; bytes are wiped from the
+ * buffer as they are handed out. Large requests are served straight from the
+ * keystream. The key is mixed with fresh OS entropy after
+ * RANDOM_RESEED_INTERVAL output bytes and after a fork().
+ *
+ * Throws std::system_error if the OS entropy source fails and std::bad_alloc
+ * if the state cannot be mapped.
+ */
+void secure_random_bytes(void* out, size_t size);
+
+#endif // RANDOM_ENGINE_H
@@ -0,0 +1,142 @@
+#include "scatter_io.h"
+
+#include <cerrno>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <climits>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace {
+
+// Fragments are handed to the kernel in batches of this many iovecs
+constexpr size_t IO_BATCH = IOV_MAX < IO_FRAGMENT_BATCH ? IOV_MAX : IO_FRAGMENT_BATCH;
+
+[[noreturn]] void throwErrno(const char* what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+void waitWritable(int fd)
+{
+    pollfd p = { fd, POLLOUT, 0 };
+    while (poll(&p, 1, -1) < 0) {
+        if (errno != EINTR)
+            throwErrno("poll");
+    }
+}
+
+/**
+ * Calls \p transfer with batches of iovecs until every byte of the fragments
+ * has been transferred, resuming partial transfers where they stopped.
+ */
+template <typename Transfer>
+size_t transferAll(int fd, const io_fragment* fragments, size_t count, const char* what, Transfer transfer)
+{
+    size_t total = 0;
+    size_t index = 0;
+    size_t offset = 0;      // bytes of fragments[index] already transferred
+
+    while (index < count) {
+        iovec iov[IO_BATCH];
+        size_t n = 0;
+        for (size_t i = index; i < count && n < IO_BATCH; ++i) {
+            size_t skip = i == index ? offset : 0;
+            if (fragments[i].size == skip)
+                continue;
+            iov[n].iov_base = static_cast<char*>(fragments[i].data) + skip;
+            iov[n].iov_len = fragments[i].size - skip;
+            ++n;
+        }
+        if (n == 0)
+            break;
+
+        ssize_t done = transfer(iov, int(n));
+        if (done < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                waitWritable(fd);
+                continue;
+            }
+            throwErrno(what);
+        }
+
+        total += size_t(done);
+        for (size_t left = size_t(done) + offset; index < count; ++index) {
+            if (left < fragments[index].size) {
+                offset = left;
+                break;
+            }
+            left -= fragments[index].size;
+            offset = 0;
+        }
+    }
+    return total;
+}
+
+} // namespace
+
+size_t write_fragments(int fd, const io_fragment* fragments, size_t count)
+{
+    return transferAll(fd, fragments, count, "writev", [fd](iovec* iov, int n) {
+        return writev(fd, iov, n);
+    });
+}
+
+size_t send_fragments(int socket, const io_fragment* fragments, size_t count, int flags)
+{
+    return transferAll(socket, fragments, count, "sendmsg", [socket, flags](iovec* iov, int n) {
+        msghdr message = {};
+        message.msg_iov = iov;
+        message.msg_iovlen = n;
+        return sendmsg(socket, &message, flags | MSG_NOSIGNAL);
+    });
+}
+
+size_t read_fragments(int fd, const io_fragment* fragments, size_t count)
+{
+    iovec iov[IO_BATCH];
+    size_t n = count < IO_BATCH ? count : IO_BATCH;
+    for (size_t i = 0; i < n; ++i) {
+        iov[i].iov_base = fragments[i].data;
+        iov[i].iov_len = fragments[i].size;
+    }
+
+    ssize_t done;
+    while ((done = readv(fd, iov, int(n))) < 0) {
+        if (errno != EINTR)
+            throwErrno("readv");
+    }
+    return size_t(done);
+}
+
+#else
+
+size_t write_fragments(int, const io_fragment*, size_t)
+{
+    throw std::system_error(std::make_error_code(std::errc::function_not_supported), "writev");
+}
+
+size_t send_fragments(int, const io_fragment*, size_t, int)
+{
+    throw std::system_error(std::make_error_code(std::errc::function_not_supported), "sendmsg");
+}
+
+size_t read_fragments(int, const io_fragment*, size_t)
+{
+    throw std::system_error(std::make_error_code(std::errc::function_not_supported), "readv");
+}
+
+#endif
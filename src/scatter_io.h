@@ -0,0 +1,41 @@
+#ifndef SCATTER_IO_H
+#define SCATTER_IO_H
+
+#include <cstddef>
+
+/**
+ * Most fragments passed to the kernel in one call (fewer where IOV_MAX is
+ * smaller), so the iovec array fits on the stack.
+ */
+constexpr size_t IO_FRAGMENT_BATCH = 64;
+
+/**
+ * One contiguous piece of a scatter-gather transfer, like struct iovec.
+ */
+struct io_fragment {
+    void* data;
+    size_t size;
+};
+
+/**
+ * Gather writes with writev() / sendmsg(). The fragments are passed to the
+ * kernel as they are, at most IO_FRAGMENT_BATCH per call, and a partial
+ * write resumes at the first byte not written. Interrupted calls are
+ * retried, and on a non-blocking descriptor the call waits for it to become
+ * writable. Returns the number of bytes written, which is always the total
+ * size of the fragments; throws std::system_error on failure.
+ * send_fragments adds MSG_NOSIGNAL where available, so a closed peer is
+ * reported as EPIPE.
+ *
+ * Scatter read with readv(): a single successful call into the first
+ * IO_FRAGMENT_BATCH fragments, the rest are not read into. Returns the
+ * number of bytes read, 0 at end of file.
+ *
+ * Only available on POSIX systems; elsewhere these throw std::system_error
+ * with std::errc::function_not_supported.
+ */
+size_t write_fragments(int fd, const io_fragment* fragments, size_t count);
+size_t send_fragments(int socket, const io_fragment* fragments, size_t count, int flags);
+size_t read_fragments(int fd, const io_fragment* fragments, size_t count);
+
+#endif // SCATTER_IO_H
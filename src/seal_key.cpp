@@ -0,0 +1,78 @@
+#include "seal_key.h"
+#include "platform.h"
+#include "random_engine.h"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace {
+
+struct seal_state {
+    uint8_t key[CHACHA20_KEY_SIZE];
+    std::atomic<uint32_t> prefix;
+    std::atomic<uint64_t> counter;
+};
+
+// Draws a random prefix and a random starting counter, 96 random bits in all
+void reseedNonce(seal_state& s)
+{
+    uint32_t prefix;
+    uint64_t counter;
+    secure_random_bytes(&prefix, sizeof(prefix));
+    secure_random_bytes(&counter, sizeof(counter));
+    s.prefix.store(prefix, std::memory_order_relaxed);
+    s.counter.store(counter, std::memory_order_relaxed);
+}
+
+// Never unmapped: sealed containers with static storage duration may still be
+// unsealed during exit.
+seal_state& state()
+{
+    static seal_state* instance = [] {
+        size_t size = (sizeof(seal_state) + page_size() - 1) / page_size() * page_size();
+        void* mapping = map_pages(size);
+        if (!mapping)
+            throw std::bad_alloc();
+        lock_pages(mapping, size);
+
+        auto* s = ::new (mapping) seal_state();
+        secure_random_bytes(s->key, sizeof(s->key));
+        reseedNonce(*s);
+
+#if defined(__unix__) || defined(__APPLE__)
+        // Parent and child share the nonce state: reseeding it keeps their
+        // nonces apart
+        pthread_atfork(nullptr, nullptr, [] {
+            try {
+                reseedNonce(state());
+            } catch (...) {
+                state().counter.store(uint64_t(1) << 63, std::memory_order_relaxed);
+            }
+        });
+#endif
+        return s;
+    }();
+    return *instance;
+}
+
+} // namespace
+
+void seal_xor(void* data, size_t size, const uint8_t* nonce)
+{
+    chacha20_xor(state().key, nonce, 0, data, size);
+}
+
+void next_seal_nonce(uint8_t* nonce)
+{
+    seal_state& s = state();
+    uint32_t prefix = s.prefix.load(std::memory_order_relaxed);
+    uint64_t counter = s.counter.fetch_add(1, std::memory_order_relaxed);
+
+    std::memcpy(nonce, &prefix, sizeof(prefix));
+    std::memcpy(nonce + sizeof(prefix), &counter, sizeof(counter));
+}
@@ -0,0 +1,25 @@
+#ifndef SEAL_KEY_H
+#define SEAL_KEY_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "chacha20.h"
+
+/**
+ * Per-process sealing key for sealed_secure. The key is drawn from
+ * secure_random_bytes() on first use and kept in a locked page of its own.
+ * seal_xor applies the ChaCha20 keystream for \p nonce to a buffer, sealing
+ * or unsealing it. next_seal_nonce returns a nonce never handed out before in
+ * this process: a 32-bit prefix and a 64-bit counter, both drawn at random on
+ * first use and again in fork()ed children. Two processes sharing the key
+ * reuse a nonce only if their prefixes match and their counter ranges overlap:
+ * for k processes that seal up to n times each that is below k^2 * n / 2^96,
+ * where a random prefix alone would collide after about 2^16 forks. Either
+ * function may be the first use, so both throw std::bad_alloc when the key page
+ * cannot be mapped.
+ */
+void seal_xor(void* data, size_t size, const uint8_t* nonce);
+void next_seal_nonce(uint8_t* nonce);
+
+#endif // SEAL_KEY_H
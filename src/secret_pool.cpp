@@ -0,0 +1,182 @@
+#include "secret_pool.h"
+#include "platform.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace {
+
+constexpr size_t SIZE_CLASSES = std::countr_zero(SECRET_MAX_BLOCK_SIZE) - std::countr_zero(SECRET_MIN_BLOCK_SIZE) + 1;
+
+static_assert(std::has_single_bit(SECRET_MIN_BLOCK_SIZE) && std::has_single_bit(SECRET_MAX_BLOCK_SIZE),
+              "Secret block sizes must be powers of two");
+static_assert(SECRET_REGION_SIZE % SECRET_MAX_BLOCK_SIZE == 0,
+              "A secret region must hold whole blocks of the largest size");
+
+struct free_block {
+    free_block* next;
+    bool zeroed;
+};
+
+struct secret_pool {
+    std::mutex mutex;
+    free_block* heads[SIZE_CLASSES] = {};
+    unsigned char* spare[SECRET_INITIAL_REGIONS] = {};
+    size_t spareCount = 0;
+    unsigned char* bump = nullptr;
+    unsigned char* bumpEnd = nullptr;
+    bool useSecret = true;
+    std::atomic<secret_memory> weakest = secret_memory::memfd_secret;
+
+    // Only called with the mutex held (or before the pool is shared)
+    void* mapRegion(size_t size) noexcept
+    {
+        if (useSecret) {
+            if (void* ptr = map_secret_pages(size))
+                return ptr;
+            useSecret = false;
+        }
+
+        void* ptr = map_pages(size);
+        if (!ptr)
+            return nullptr;
+
+        // Unlike a memfd_secret mapping the child would get a private copy
+        wipe_pages_on_fork(ptr, size);
+        secret_memory kind = lock_pages(ptr, size) ? secret_memory::locked : secret_memory::unlocked;
+        if (kind > weakest.load(std::memory_order_relaxed))
+            weakest.store(kind, std::memory_order_relaxed);
+        return ptr;
+    }
+
+    secret_pool() noexcept
+    {
+        for (; spareCount < SECRET_INITIAL_REGIONS; ++spareCount) {
+            spare[spareCount] = static_cast<unsigned char*>(mapRegion(SECRET_REGION_SIZE));
+            if (!spare[spareCount])
+                break;
+        }
+    }
+
+    bool nextRegion() noexcept
+    {
+        // Regions are never unmapped: their blocks live on in the free lists
+        auto* region = spareCount ? spare[--spareCount]
+                                  : static_cast<unsigned char*>(mapRegion(SECRET_REGION_SIZE));
+        if (!region)
+            return false;
+
+        bump = region;
+        bumpEnd = region + SECRET_REGION_SIZE;
+        return true;
+    }
+};
+
+secret_pool& pool()
+{
+    // Never destroyed: blocks may still be released during static destruction
+    static secret_pool* instance = new secret_pool();
+    return *instance;
+}
+
+size_t classIndex(size_t blockSize) noexcept
+{
+    return std::countr_zero(blockSize) - std::countr_zero(SECRET_MIN_BLOCK_SIZE);
+}
+
+size_t blockSizeFor(size_t bytes, size_t alignment) noexcept
+{
+    return std::bit_ceil(std::max({ bytes, alignment, SECRET_MIN_BLOCK_SIZE }));
+}
+
+size_t regionSizeFor(size_t bytes) noexcept
+{
+    size_t page = page_size();
+    return (bytes + page - 1) / page * page;
+}
+
+void release(void* ptr, size_t bytes, size_t alignment, bool zeroed) noexcept
+{
+    size_t blockSize = blockSizeFor(bytes, alignment);
+    if (blockSize > SECRET_MAX_BLOCK_SIZE) {
+        unmap_pages(ptr, regionSizeFor(bytes));
+        return;
+    }
+
+    secret_pool& sp = pool();
+    std::lock_guard lock(sp.mutex);
+
+    auto* block = static_cast<free_block*>(ptr);
+    block->next = sp.heads[classIndex(blockSize)];
+    block->zeroed = zeroed;
+    sp.heads[classIndex(blockSize)] = block;
+}
+
+} // namespace
+
+void* secret_allocate(size_t bytes, size_t alignment)
+{
+    secret_pool& sp = pool();
+    size_t blockSize = blockSizeFor(bytes, alignment);
+
+    if (blockSize > SECRET_MAX_BLOCK_SIZE) {
+        void* ptr;
+        {
+            std::lock_guard lock(sp.mutex);
+            ptr = sp.mapRegion(regionSizeFor(bytes));
+        }
+        if (!ptr)
+            throw std::bad_alloc();
+        return ptr;
+    }
+
+    free_block* block;
+    {
+        std::lock_guard lock(sp.mutex);
+
+        block = sp.heads[classIndex(blockSize)];
+        if (block) {
+            sp.heads[classIndex(blockSize)] = block->next;
+        } else {
+            // Fresh region memory is zero. The free lists are keyed by size
+            // only, so every block is aligned to its size: a recycled block
+            // then serves any alignment that maps to the same class
+            auto aligned = [&] {
+                auto addr = reinterpret_cast<uintptr_t>(sp.bump);
+                return reinterpret_cast<unsigned char*>((addr + blockSize - 1) & ~uintptr_t(blockSize - 1));
+            };
+
+            if (!sp.bump || reinterpret_cast<uintptr_t>(aligned()) + blockSize > reinterpret_cast<uintptr_t>(sp.bumpEnd)) {
+                if (!sp.nextRegion())
+                    throw std::bad_alloc();
+            }
+
+            unsigned char* p = aligned();
+            sp.bump = p + blockSize;
+            return p;
+        }
+    }
+
+    std::memset(block, 0, block->zeroed ? sizeof(free_block) : blockSize);
+    return block;
+}
+
+void secret_deallocate(void* ptr, size_t bytes, size_t alignment) noexcept
+{
+    release(ptr, bytes, alignment, false);
+}
+
+void secret_deallocate_zeroed(void* ptr, size_t bytes, size_t alignment) noexcept
+{
+    release(ptr, bytes, alignment, true);
+}
+
+secret_memory secret_memory_kind() noexcept
+{
+    return pool().weakest.load(std::memory_order_relaxed);
+}
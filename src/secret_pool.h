@@ -0,0 +1,45 @@
+#ifndef SECRET_POOL_H
+#define SECRET_POOL_H
+
+#include <cstddef>
+
+constexpr size_t SECRET_REGION_SIZE = 256 * 1024;
+constexpr size_t SECRET_INITIAL_REGIONS = 4;
+constexpr size_t SECRET_MIN_BLOCK_SIZE = 16;
+constexpr size_t SECRET_MAX_BLOCK_SIZE = 16 * 1024;
+
+/**
+ * Kind of memory the secret pool hands out, from the strongest to the weakest
+ * isolation: memfd_secret pages (outside the kernel direct map), locked
+ * anonymous pages, or plain anonymous pages when they could not be locked.
+ */
+enum class secret_memory {
+    memfd_secret,
+    locked,
+    unlocked
+};
+
+/**
+ * Allocator for small secrets. On first use SECRET_INITIAL_REGIONS regions of
+ * SECRET_REGION_SIZE bytes are mapped with map_secret_pages(); if memfd_secret
+ * turns out to be unavailable, this and all later regions are locked anonymous
+ * mappings instead. Blocks of up to SECRET_MAX_BLOCK_SIZE bytes are carved from
+ * the regions and recycled through power-of-two free lists, so a syscall is
+ * only made when every region is used up. Larger blocks get a region of their
+ * own, which is unmapped on deallocation.
+ *
+ * Like the block pool, secret_allocate always returns a zero-filled block and
+ * blocks released with secret_deallocate_zeroed are reused without clearing.
+ * Alignment must not exceed page_size().
+ */
+void* secret_allocate(size_t bytes, size_t alignment);
+void secret_deallocate(void* ptr, size_t bytes, size_t alignment) noexcept;
+void secret_deallocate_zeroed(void* ptr, size_t bytes, size_t alignment) noexcept;
+
+/**
+ * Weakest kind of memory the pool has mapped so far; maps the initial regions
+ * if that has not happened yet.
+ */
+secret_memory secret_memory_kind() noexcept;
+
+#endif // SECRET_POOL_H
@@ -0,0 +1,98 @@
+#include "secret_scan.h"
+#include "platform.h"
+#include "vector_extensions.h"
+
+#include <cstring>
+
+namespace {
+
+#ifdef __VECTOR_EXTENSIONS__
+constexpr size_t VECTOR_SIZE = 32;
+typedef uint8_t bytes_t __attribute__((vector_size(VECTOR_SIZE)));
+typedef uint8_t half_bytes_t __attribute__((vector_size(VECTOR_SIZE / 2)));
+typedef uint64_t words_t __attribute__((vector_size(VECTOR_SIZE)));
+typedef uint64_t half_words_t __attribute__((vector_size(VECTOR_SIZE / 2)));
+#endif
+
+// OR of the XOR of the two slots: 0 if and only if they are equal. Width is a
+// compile-time constant for the common key sizes and 0 for the others, which
+// pass their width at runtime.
+template <size_t Width>
+__ALWAYS_INLINE uint64_t slotDiff(const uint8_t* a, const uint8_t* b, size_t width) noexcept
+{
+    if constexpr (Width != 0)
+        width = Width;
+
+    uint64_t diff = 0;
+    size_t j = 0;
+#ifdef __VECTOR_EXTENSIONS__
+    bytes_t acc{};
+    for (; width - j >= VECTOR_SIZE; j += VECTOR_SIZE) {
+        bytes_t x, y;
+        std::memcpy(&x, a + j, sizeof(x));
+        std::memcpy(&y, b + j, sizeof(y));
+        acc |= x ^ y;
+    }
+    words_t words = words_t(acc);
+    diff = words[0] | words[1] | words[2] | words[3];
+
+    if (width - j >= VECTOR_SIZE / 2) {
+        half_bytes_t x, y;
+        std::memcpy(&x, a + j, sizeof(x));
+        std::memcpy(&y, b + j, sizeof(y));
+        half_words_t half = half_words_t(x ^ y);
+        diff |= half[0] | half[1];
+        j += VECTOR_SIZE / 2;
+    }
+#endif
+    for (; width - j >= sizeof(uint64_t); j += sizeof(uint64_t)) {
+        uint64_t x, y;
+        std::memcpy(&x, a + j, sizeof(x));
+        std::memcpy(&y, b + j, sizeof(y));
+        diff |= x ^ y;
+    }
+    for (; j < width; ++j)
+        diff |= uint64_t(a[j] ^ b[j]);
+    return diff;
+}
+
+template <size_t Width>
+__ALWAYS_INLINE size_t scanSlots(const uint8_t* slots, const uint32_t* generations, size_t count, size_t width,
+                               const uint8_t* secret) noexcept
+{
+    size_t found = SECRET_SLOT_NOT_FOUND;
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t diff = slotDiff<Width>(slots + i * width, secret, width);
+
+        // all ones if the slot is equal and occupied, 0 otherwise
+        size_t equal = size_t(((diff | (0 - diff)) >> 63) ^ 1);
+        size_t mask = 0 - (equal & generations[i]);
+        found = (found & ~mask) | (i & mask);
+    }
+    return found;
+}
+
+__VECTOR_CLONES size_t scan(const uint8_t* slots, const uint32_t* generations, size_t count, size_t width,
+                          const uint8_t* secret) noexcept
+{
+    switch (width) {
+    case 16:
+        return scanSlots<16>(slots, generations, count, width, secret);
+    case 32:
+        return scanSlots<32>(slots, generations, count, width, secret);
+    case 64:
+        return scanSlots<64>(slots, generations, count, width, secret);
+    default:
+        return scanSlots<0>(slots, generations, count, width, secret);
+    }
+}
+
+} // namespace
+
+size_t find_secret_slot(const uint8_t* slots, const uint32_t* generations, size_t count, size_t width,
+                        const uint8_t* secret) noexcept
+{
+    size_t found = scan(slots, generations, count, width, secret);
+    burn_stack(VECTOR_STACK_DEPTH);
+    return found;
+}
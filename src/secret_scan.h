@@ -0,0 +1,23 @@
+#ifndef SECRET_SCAN_H
+#define SECRET_SCAN_H
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr size_t SECRET_SLOT_NOT_FOUND = SIZE_MAX;
+
+/**
+ * Constant-time search of \p count fixed-width slots stored back to back at
+ * \p slots. Every byte of every slot is compared with \p secret and the match
+ * is selected with masks, a vector at a time (the AVX2 variant is picked at
+ * runtime where the compiler supports it), so the timing depends on \p count
+ * and \p width only. A slot takes part if its generation is odd (occupied).
+ *
+ * Returns the index of the last matching occupied slot, or
+ * SECRET_SLOT_NOT_FOUND. The stack below the call is scrubbed before
+ * returning.
+ */
+size_t find_secret_slot(const uint8_t* slots, const uint32_t* generations, size_t count, size_t width,
+                        const uint8_t* secret) noexcept;
+
+#endif // SECRET_SCAN_H
@@ -0,0 +1,139 @@
+#include "siphash.h"
+#include "platform.h"
+#include "random_engine.h"
+
+#include <cstring>
+#include <new>
+
+namespace {
+
+inline uint64_t load64(const uint8_t* p) noexcept
+{
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+inline uint32_t load32(const uint8_t* p) noexcept
+{
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap32(v);
+#endif
+    return v;
+}
+
+/**
+ * Little-endian value of the last size % 8 bytes at \p p, read with as few
+ * loads as possible. \p whole is the length of the complete input: when it is
+ * at least 8 the tail is read with one load that ends at the last byte.
+ */
+inline uint64_t loadTail(const uint8_t* p, size_t tail, size_t whole) noexcept
+{
+    if (tail == 0)
+        return 0;
+    if (whole >= 8)
+        return load64(p + tail - 8) >> (64 - 8 * tail);
+    if (tail >= 4)
+        return load32(p) | uint64_t(load32(p + tail - 4)) << (8 * (tail - 4));
+
+    return uint64_t(p[0]) | uint64_t(p[tail / 2]) << (8 * (tail / 2)) | uint64_t(p[tail - 1]) << (8 * (tail - 1));
+}
+
+struct sip_state {
+    uint64_t v0, v1, v2, v3;
+
+    sip_state(uint64_t k0, uint64_t k1) noexcept
+        : v0(k0 ^ 0x736f6d6570736575)
+        , v1(k1 ^ 0x646f72616e646f6d)
+        , v2(k0 ^ 0x6c7967656e657261)
+        , v3(k1 ^ 0x7465646279746573)
+    {}
+
+    void round() noexcept
+    {
+        v0 += v1; v1 = rotl(v1, 13); v1 ^= v0; v0 = rotl(v0, 32);
+        v2 += v3; v3 = rotl(v3, 16); v3 ^= v2;
+        v0 += v3; v3 = rotl(v3, 21); v3 ^= v0;
+        v2 += v1; v1 = rotl(v1, 17); v1 ^= v2; v2 = rotl(v2, 32);
+    }
+
+    void compress(uint64_t m) noexcept
+    {
+        v3 ^= m;
+        round();
+        round();
+        v0 ^= m;
+    }
+
+    uint64_t finish() noexcept
+    {
+        v2 ^= 0xff;
+        round();
+        round();
+        round();
+        round();
+        return v0 ^ v1 ^ v2 ^ v3;
+    }
+
+    static uint64_t rotl(uint64_t v, int n) noexcept
+    {
+        return (v << n) | (v >> (64 - n));
+    }
+};
+
+inline uint64_t hash(uint64_t k0, uint64_t k1, const void* data, size_t size) noexcept
+{
+    auto* p = static_cast<const uint8_t*>(data);
+    sip_state s(k0, k1);
+
+    const uint8_t* end = p + (size & ~size_t(7));
+    for (; p != end; p += 8)
+        s.compress(load64(p));
+
+    s.compress(uint64_t(size) << 56 | loadTail(p, size & 7, size));
+    return s.finish();
+}
+
+struct hash_key {
+    uint64_t k0, k1;
+};
+
+// Never unmapped: hashes may still be computed during exit
+const hash_key& processKey()
+{
+    static const hash_key* key = [] {
+        size_t size = page_size();
+        void* page = map_pages(size);
+        if (!page)
+            throw std::bad_alloc();
+        lock_pages(page, size);
+
+        auto* k = static_cast<hash_key*>(page);
+        try {
+            secure_random_bytes(k, sizeof(*k));
+        } catch (...) {
+            unmap_pages(page, size);
+            throw;
+        }
+        return k;
+    }();
+    return *key;
+}
+
+} // namespace
+
+uint64_t siphash24(const uint8_t* key, const void* data, size_t size) noexcept
+{
+    return hash(load64(key), load64(key + 8), data, size);
+}
+
+uint64_t process_hash(const void* data, size_t size)
+{
+    const hash_key& key = processKey();
+    return hash(key.k0, key.k1, data, size);
+}
@@ -0,0 +1,26 @@
+#ifndef SIPHASH_H
+#define SIPHASH_H
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr size_t SIPHASH_KEY_SIZE = 16;
+
+/**
+ * SipHash-2-4 with a 128-bit key, as in the reference implementation. The
+ * last partial word is read with at most two overlapping loads instead of a
+ * byte at a time, which is most of the work for short hash table keys.
+ */
+uint64_t siphash24(const uint8_t* key, const void* data, size_t size) noexcept;
+
+/**
+ * SipHash-2-4 under a per-process key, which is drawn from
+ * secure_random_bytes() on first use and kept in a locked page of its own.
+ * fork()ed children keep the key, so hash tables they inherit stay valid.
+ *
+ * The first call throws std::bad_alloc if the page cannot be mapped and
+ * std::system_error if the OS entropy source fails.
+ */
+uint64_t process_hash(const void* data, size_t size);
+
+#endif // SIPHASH_H
@@ -0,0 +1,82 @@
+#include "platform.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#define __NOINLINE __declspec(noinline)
+#define __ALLOCA(size) _alloca(size)
+#else
+#define __NOINLINE __attribute__((noinline))
+#define __ALLOCA(size) __builtin_alloca(size)
+#endif
+
+// The stack is assumed to grow downwards. Every function below works on a
+// buffer allocated in its own frame, which lies right under the caller's
+// frame: the painted span, and later the scrubbed one, are addressed through
+// it. Bytes between the buffer and the caller hold the helper's own frame,
+// which overwrites whatever was there.
+
+namespace {
+
+constexpr uint64_t CANARY = 0x5ca1ab1e0ddba11full;
+
+// Room above the painted span, so that the scrubbing helper's buffer reaches
+// up to the painted top even if its frame is a little smaller.
+constexpr size_t FRAME_SLACK = 512;
+
+static_assert(STACK_CANARY_STRIDE % sizeof(uint64_t) == 0, "Canaries must stay aligned");
+
+uintptr_t alignDown(uintptr_t value, uintptr_t alignment) noexcept
+{
+    return value & ~(alignment - 1);
+}
+
+} // namespace
+
+__NOINLINE void burn_stack(size_t depth) noexcept
+{
+    void* buffer = __ALLOCA(depth);
+    burn(buffer, depth);
+}
+
+__NOINLINE void* paint_stack(size_t depth) noexcept
+{
+    auto* buffer = static_cast<unsigned char*>(__ALLOCA(depth + FRAME_SLACK));
+    uintptr_t top = alignDown(reinterpret_cast<uintptr_t>(buffer) + depth + FRAME_SLACK, STACK_CANARY_STRIDE);
+    uintptr_t bottom = top - alignDown(depth, STACK_CANARY_STRIDE);
+
+    for (uintptr_t p = bottom; p < top; p += STACK_CANARY_STRIDE)
+        *reinterpret_cast<volatile uint64_t*>(p) = CANARY;
+    return reinterpret_cast<void*>(top);
+}
+
+__NOINLINE size_t scrub_painted_stack(void* top, size_t depth) noexcept
+{
+    auto* buffer = static_cast<unsigned char*>(__ALLOCA(depth + FRAME_SLACK));
+    auto begin = reinterpret_cast<uintptr_t>(buffer);
+    auto end = begin + depth + FRAME_SLACK;
+
+    // Only the part of the painted span that lies inside our buffer is read
+    uintptr_t paintedTop = reinterpret_cast<uintptr_t>(top);
+    uintptr_t paintedBottom = paintedTop - alignDown(depth, STACK_CANARY_STRIDE);
+    uintptr_t scan = paintedBottom;
+    while (scan < begin)
+        scan += STACK_CANARY_STRIDE;
+
+    uintptr_t highWater = paintedTop;
+    for (; scan + sizeof(uint64_t) <= end && scan < paintedTop; scan += STACK_CANARY_STRIDE) {
+        if (*reinterpret_cast<volatile uint64_t*>(scan) != CANARY) {
+            highWater = scan;
+            break;
+        }
+    }
+
+    uintptr_t from = highWater - STACK_SCRUB_MARGIN;
+    if (from < begin || from > highWater)
+        from = begin;
+
+    burn(reinterpret_cast<void*>(from), end - from);
+    return end - from;
+}
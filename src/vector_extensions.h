@@ -0,0 +1,36 @@
+#ifndef VECTOR_EXTENSIONS_H
+#define VECTOR_EXTENSIONS_H
+
+#include <cstddef>
+
+/**
+ * Shared by the vectorized translation units. __VECTOR_EXTENSIONS__ is defined
+ * where the GCC/Clang vector types are available. __VECTOR_CLONES builds a
+ * function for AVX2 and for the baseline ISA and picks one at load time (ELF
+ * x86-64 only); its helpers are __ALWAYS_INLINE so that they are compiled into
+ * each clone rather than once for the baseline ISA.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define __VECTOR_EXTENSIONS__
+#endif
+
+#if defined(__VECTOR_EXTENSIONS__) && defined(__x86_64__) && defined(__ELF__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define __VECTOR_CLONES __attribute__((target_clones("avx2", "default")))
+#endif
+#endif
+
+#ifndef __VECTOR_CLONES
+#define __VECTOR_CLONES
+#endif
+
+#if defined(__VECTOR_EXTENSIONS__)
+#define __ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define __ALWAYS_INLINE inline
+#endif
+
+// Spills of a vector loop over 32-byte registers stay within this depth
+constexpr size_t VECTOR_STACK_DEPTH = 1024;
+
+#endif // VECTOR_EXTENSIONS_H
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cpp_sc/basic_string_secure.h>
+#include <cpp_sc/vector_secure.h>
+
+static size_t allocations = 0;
+
+template <typename T>
+struct CountingAllocator : std::allocator<T> {
+    CountingAllocator() = default;
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n)
+    {
+        ++allocations;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+template <typename T>
+using counting_sanitizing_allocator = sanitizing_allocator_base<T, CountingAllocator>;
+
+template <typename T, typename Growth = standard_growth>
+using counted_vector = vector_secure<T, counting_sanitizing_allocator<T>, Growth>;
+
+template <typename Growth = standard_growth>
+using counted_string = basic_string_secure<char, counting_sanitizing_allocator<char>, Growth>;
+
+
+class GrowthPolicyTest : public testing::Test {
+protected:
+    void SetUp()
+    {
+        allocations = 0;
+    }
+};
+
+TEST_F(GrowthPolicyTest, StandardGrowthShouldDoubleCapacity)
+{
+    EXPECT_EQ(standard_growth::next_capacity(0, 1), 1u);
+    EXPECT_EQ(standard_growth::next_capacity(8, 9), 16u);
+    EXPECT_EQ(standard_growth::next_capacity(8, 100), 100u);
+
+    counted_vector<uint32_t> vec;
+    for (uint32_t i = 0; i < 1000; ++i)
+        vec.push_back(i);
+
+    EXPECT_EQ(allocations, 11u);
+}
+
+TEST_F(GrowthPolicyTest, ExactGrowthShouldLeaveNoSpareCapacity)
+{
+    counted_vector<uint32_t, exact_growth> vec;
+    for (uint32_t i = 0; i < 10; ++i) {
+        vec.push_back(i);
+        EXPECT_EQ(vec.capacity(), vec.size());
+    }
+
+    vec.resize(100);
+    EXPECT_EQ(vec.capacity(), 100u);
+    EXPECT_EQ(vec[9], 9u);
+}
+
+TEST_F(GrowthPolicyTest, LearnedGrowthShouldReserveRecordedSizeOnce)
+{
+    using growth = learned_growth<struct vector_tag>;
+    {
+        counted_vector<uint32_t, growth> vec;
+        for (uint32_t i = 0; i < 1000; ++i)
+            vec.push_back(i);
+    }
+    EXPECT_EQ(growth::learned_size(), 1000u);
+
+    allocations = 0;
+    counted_vector<uint32_t, growth> vec;
+    for (uint32_t i = 0; i < 1000; ++i)
+        vec.push_back(i);
+
+    EXPECT_EQ(allocations, 1u);
+    EXPECT_EQ(vec.capacity(), 1000u);
+    EXPECT_EQ(vec[999], 999u);
+}
+
+TEST_F(GrowthPolicyTest, LearnedGrowthShouldFallBackPastRecordedSize)
+{
+    using growth = learned_growth<struct fallback_tag>;
+    growth::record(100);
+
+    counted_vector<uint8_t, growth> vec;
+    vec.resize(50);
+    EXPECT_EQ(vec.capacity(), 100u);
+
+    vec.resize(101);
+    EXPECT_EQ(vec.capacity(), 200u);
+}
+
+TEST_F(GrowthPolicyTest, LearnedSizeShouldDecayTowardsSmallerSizes)
+{
+    using growth = learned_growth<struct decay_tag>;
+    growth::record(1000);
+    growth::record(200);
+    EXPECT_EQ(growth::learned_size(), 900u);
+
+    growth::record(0);
+    EXPECT_EQ(growth::learned_size(), 900u);
+
+    growth::record(2000);
+    EXPECT_EQ(growth::learned_size(), 2000u);
+
+    growth::reset();
+    EXPECT_EQ(growth::learned_size(), 0u);
+}
+
+TEST_F(GrowthPolicyTest, LearnedGrowthShouldApplyToStringAppends)
+{
+    using growth = learned_growth<struct string_tag>;
+    {
+        counted_string<growth> str;
+        for (int i = 0; i < 100; ++i)
+            str += "0123456789";
+    }
+    EXPECT_EQ(growth::learned_size(), 1000u);
+
+    allocations = 0;
+    counted_string<growth> str;
+    for (int i = 0; i < 50; ++i) {
+        str += std::string_view("01234");
+        str.append("56789", 5);
+        str.push_back('x');
+        str.append(3, 'y');
+    }
+
+    EXPECT_EQ(allocations, 1u);
+    EXPECT_EQ(str.size(), 700u);
+}
+
+TEST_F(GrowthPolicyTest, StringAppendOfItselfShouldSurviveGrowth)
+{
+    using growth = learned_growth<struct self_append_tag>;
+    growth::record(64);
+
+    counted_string<growth> str("0123456789");
+    str.append(str.data(), str.size());
+    str += str;
+
+    EXPECT_EQ(std::string_view(str), "0123456789012345678901234567890123456789");
+}
+
+TEST_F(GrowthPolicyTest, EmplaceFromOwnElementShouldSurviveLearnedGrowth)
+{
+    using growth = learned_growth<struct alias_tag>;
+    growth::record(16);
+
+    counted_vector<std::string, growth> vec;
+    vec.emplace_back(100, 'a');
+    vec.push_back(vec[0]);
+    vec.resize(vec.capacity() + 1, vec[1]);
+
+    ASSERT_EQ(vec.size(), 17u);
+    EXPECT_EQ(vec[16], std::string(100, 'a'));
+}
+
+TEST_F(GrowthPolicyTest, NestedSecureStringsShouldKeepContentsWithLearnedGrowth)
+{
+    using growth = learned_growth<struct nested_tag>;
+    growth::record(8);
+
+    vector_secure<string_secure, sanitizing_allocator<string_secure>, growth> vec;
+    for (int i = 0; i < 20; ++i)
+        vec.emplace_back(i % 2 ? "short" : "long enough to be on the heap");
+
+    EXPECT_EQ(vec.capacity(), 32u);
+    EXPECT_EQ(std::string_view(vec[18]), "long enough to be on the heap");
+    EXPECT_EQ(std::string_view(vec[19]), "short");
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <numeric>
+
+#include <cpp_sc/mapped_vector_secure.h>
+
+using small_threshold_vector = mapped_vector_secure<uint8_t, 4096>;
+
+
+static bool holdsSequence(const small_threshold_vector& vec)
+{
+    for (size_t i = 0; i < vec.size(); ++i) {
+        if (vec[i] != uint8_t(i))
+            return false;
+    }
+    return true;
+}
+
+TEST(MappedVectorSecureTest, SmallBufferShouldNotBeMapped)
+{
+    small_threshold_vector vec = { 1, 2, 3 };
+
+    EXPECT_FALSE(vec.is_mapped());
+    EXPECT_EQ(vec.size(), 3u);
+}
+
+TEST(MappedVectorSecureTest, GrowingPastThresholdShouldMoveToMapping)
+{
+    small_threshold_vector vec;
+    for (size_t i = 0; i < 10000; ++i)
+        vec.push_back(uint8_t(i));
+
+    EXPECT_TRUE(vec.is_mapped());
+    EXPECT_EQ(vec.size(), 10000u);
+    EXPECT_TRUE(holdsSequence(vec));
+}
+
+TEST(MappedVectorSecureTest, GrowingMappedBufferShouldPreserveContents)
+{
+    small_threshold_vector vec;
+    vec.resize(8192);
+    std::iota(vec.begin(), vec.end(), uint8_t(0));
+    ASSERT_TRUE(vec.is_mapped());
+
+    vec.reserve(1024 * 1024);
+
+    EXPECT_GE(vec.capacity(), 1024u * 1024);
+    EXPECT_TRUE(holdsSequence(vec));
+}
+
+TEST(MappedVectorSecureTest, ResizeShouldValueInitializeNewElements)
+{
+    small_threshold_vector vec(16);
+    std::fill(vec.begin(), vec.end(), uint8_t(0xff));
+
+    vec.resize(4);
+    vec.resize(100000);
+
+    EXPECT_TRUE(std::all_of(vec.begin() + 4, vec.end(), [](uint8_t b) { return b == 0; }));
+}
+
+TEST(MappedVectorSecureTest, ResizeShouldValueInitializeWithPatternWipe)
+{
+    using pattern_allocator = sanitizing_allocator_base<uint8_t, std::allocator, pattern_fill<0xa5>{}>;
+    mapped_vector_secure<uint8_t, 4096, pattern_allocator> vec(8192);
+    std::fill(vec.begin(), vec.end(), uint8_t(0xff));
+    ASSERT_TRUE(vec.is_mapped());
+
+    vec.resize(4);
+    vec.resize(8192);
+
+    EXPECT_TRUE(std::all_of(vec.begin() + 4, vec.end(), [](uint8_t b) { return b == 0; }));
+}
+
+TEST(MappedVectorSecureTest, ShrinkingShouldWipeDroppedElements)
+{
+    small_threshold_vector vec(8192);
+    std::fill(vec.begin(), vec.end(), uint8_t(0xff));
+    const uint8_t* ptr = vec.data();
+
+    vec.resize(100);
+
+    EXPECT_TRUE(std::all_of(ptr + 100, ptr + 8192, [](uint8_t b) { return b == 0; }));
+}
+
+TEST(MappedVectorSecureTest, MoveConstructorShouldTransferMapping)
+{
+    small_threshold_vector vec(8192);
+    uint8_t* ptr = vec.data();
+
+    small_threshold_vector moved(std::move(vec));
+
+    EXPECT_EQ(moved.data(), ptr);
+    EXPECT_TRUE(moved.is_mapped());
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.data(), nullptr);
+}
+
+TEST(MappedVectorSecureTest, MethodCopyShouldCopiesDataCorrectly)
+{
+    small_threshold_vector vec(8192);
+    std::iota(vec.begin(), vec.end(), uint8_t(0));
+
+    small_threshold_vector copied = small_threshold_vector::copy(vec);
+
+    EXPECT_NE(copied.data(), vec.data());
+    EXPECT_TRUE(std::equal(vec.begin(), vec.end(), copied.begin(), copied.end()));
+}
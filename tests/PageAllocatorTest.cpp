@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include <cpp_sc/page_allocator.h>
+#include <cpp_sc/vector_secure.h>
+
+#include "testUtils.h"
+
+template <typename T>
+using small_page_allocator = page_allocator<T, 64 * 1024>;
+
+
+TEST(DiscardPagesTest, ShouldWipeUnalignedRangeAndKeepNeighbours)
+{
+    size_t page = page_size();
+    size_t size = page * 4;
+    auto* buffer = static_cast<unsigned char*>(map_pages(size));
+    ASSERT_NE(buffer, nullptr);
+    std::memset(buffer, 0xa5, size);
+
+    size_t offset = page / 2;
+    size_t length = page * 3;
+    ASSERT_TRUE(discard_pages(buffer + offset, length));
+
+    EXPECT_TRUE(allBytesAre(buffer, offset, 0xa5));
+    EXPECT_TRUE(allBytesAre(buffer + offset, length, 0));
+    EXPECT_TRUE(allBytesAre(buffer + offset + length, size - offset - length, 0xa5));
+
+    unmap_pages(buffer, size);
+}
+
+TEST(DiscardPagesTest, ShouldRefuseRangeWithoutWholePage)
+{
+    size_t page = page_size();
+    auto* buffer = static_cast<unsigned char*>(map_pages(page * 2));
+    ASSERT_NE(buffer, nullptr);
+    std::memset(buffer, 0xa5, page * 2);
+
+    EXPECT_FALSE(discard_pages(buffer + page / 2, page));
+    EXPECT_TRUE(allBytesAre(buffer, page * 2, 0xa5));
+
+    unmap_pages(buffer, page * 2);
+}
+
+#if defined(__linux__)
+TEST(DiscardPagesTest, ShouldRefuseLockedPages)
+{
+    size_t size = page_size() * 2;
+    auto* buffer = static_cast<unsigned char*>(map_pages(size));
+    ASSERT_NE(buffer, nullptr);
+    if (mlock(buffer, size) != 0) {
+        unmap_pages(buffer, size);
+        GTEST_SKIP() << "mlock is not permitted";
+    }
+    std::memset(buffer, 0xa5, size);
+
+    EXPECT_FALSE(discard_pages(buffer, size));
+    EXPECT_TRUE(allBytesAre(buffer, size, 0xa5));
+
+    munlock(buffer, size);
+    unmap_pages(buffer, size);
+}
+#endif // __linux__
+
+
+TEST(PageAllocatorTest, LargeBlockShouldBePageAlignedAndZeroed)
+{
+    small_page_allocator<uint8_t> alloc;
+    size_t size = 64 * 1024;
+    uint8_t* p = alloc.allocate(size);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % page_size(), 0u);
+    EXPECT_TRUE(allBytesAre(p, size, 0));
+
+    alloc.deallocate(p, size);
+}
+
+TEST(PageAllocatorTest, DiscardShouldWipeLargeBlock)
+{
+    small_page_allocator<uint8_t> alloc;
+    size_t size = 64 * 1024 + 100;
+    uint8_t* p = alloc.allocate(size);
+    std::memset(p, 0xa5, size);
+
+    ASSERT_TRUE(small_page_allocator<uint8_t>::discard(p, size));
+    EXPECT_TRUE(allBytesAre(p, size, 0));
+
+    alloc.deallocate(p, size);
+}
+
+TEST(PageAllocatorTest, SmallBlockShouldNotBeDiscarded)
+{
+    small_page_allocator<uint8_t> alloc;
+    uint8_t* p = alloc.allocate(100);
+    EXPECT_TRUE(allBytesAre(p, 100, 0));
+
+    EXPECT_FALSE(small_page_allocator<uint8_t>::discard(p, 100));
+
+    alloc.deallocate(p, 100);
+}
+
+TEST(PageAllocatorTest, VectorSecureShouldGrowAcrossThreshold)
+{
+    vector_secure<int, sanitizing_allocator_base<int, small_page_allocator>> vec;
+    for (int i = 0; i < 100000; ++i)
+        vec.push_back(i);
+
+    EXPECT_EQ(vec.size(), 100000u);
+    EXPECT_EQ(vec[99999], 99999);
+
+    vec.resize(10);
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.back(), 9);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstring>
+#include <thread>
+
+#include <cpp_sc/parallel_sanitizing_allocator.h>
+#include <cpp_sc/vector_secure.h>
+
+#include "testUtils.h"
+
+
+class ParallelBurnTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        threshold_ = parallel_wipe_threshold();
+        workers_ = parallel_wipe_workers();
+        set_parallel_wipe_threshold(PARALLEL_WIPE_CHUNK);
+        set_parallel_wipe_workers(3);
+    }
+
+    void TearDown() override
+    {
+        set_parallel_wipe_threshold(threshold_);
+        set_parallel_wipe_workers(workers_);
+    }
+
+private:
+    size_t threshold_ = 0;
+    unsigned workers_ = 0;
+};
+
+TEST_F(ParallelBurnTest, ShouldWipeUnalignedRangeAndKeepNeighbours)
+{
+    constexpr size_t SIZE = 40 * PARALLEL_WIPE_CHUNK;
+    std::vector<unsigned char> buffer(SIZE, 0xa5);
+
+    size_t offset = 13;
+    size_t length = SIZE - 2 * offset - 7;
+    parallel_burn(buffer.data() + offset, length);
+
+    EXPECT_TRUE(allBytesAre(buffer.data(), offset, 0xa5));
+    EXPECT_TRUE(allBytesAre(buffer.data() + offset, length, 0));
+    EXPECT_TRUE(allBytesAre(buffer.data() + offset + length, SIZE - offset - length, 0xa5));
+}
+
+TEST_F(ParallelBurnTest, ShouldWipeWithMoreWorkersThanChunks)
+{
+    set_parallel_wipe_workers(8);
+    std::vector<unsigned char> buffer(PARALLEL_WIPE_CHUNK + 100, 0xa5);
+
+    parallel_burn(buffer.data(), buffer.size());
+    EXPECT_TRUE(allBytesAre(buffer.data(), buffer.size(), 0));
+
+    set_parallel_wipe_workers(1);
+    std::memset(buffer.data(), 0xa5, buffer.size());
+    parallel_burn(buffer.data(), buffer.size());
+    EXPECT_TRUE(allBytesAre(buffer.data(), buffer.size(), 0));
+}
+
+TEST_F(ParallelBurnTest, ConcurrentWipesShouldAllComplete)
+{
+    constexpr int THREADS = 4;
+    constexpr size_t SIZE = 4 * PARALLEL_WIPE_CHUNK;
+    std::vector<std::vector<unsigned char>> buffers(THREADS, std::vector<unsigned char>(SIZE));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&buffer = buffers[t]] {
+            for (int i = 0; i < 10; ++i) {
+                std::memset(buffer.data(), 0xa5, buffer.size());
+                parallel_burn(buffer.data(), buffer.size());
+                ASSERT_TRUE(allBytesAre(buffer.data(), buffer.size(), 0));
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+}
+
+TEST_F(ParallelBurnTest, AllocatorShouldWipeOnDeallocate)
+{
+    using Allocator = parallel_sanitizing_allocator<uint8_t>;
+    vector_secure<uint8_t, Allocator> vec(4 * PARALLEL_WIPE_CHUNK);
+    std::memset(vec.data(), 0xa5, vec.size());
+
+    EXPECT_EQ(vec.size(), 4 * PARALLEL_WIPE_CHUNK);
+    vec.clear();
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.capacity(), 0u);
+}
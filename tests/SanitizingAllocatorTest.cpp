@@ -2,6 +2,8 @@
 #include <gmock/gmock.h>
 
 #include <cpp_sc/sanitizing_allocator.h>
+#include <cpp_sc/calloc_allocator.h>
+#include <cpp_sc/pool_allocator.h>
 
 using testing::_;
 
@@ -23,18 +25,22 @@ template <typename T>
 class CleanseTest : public testing::Test {
 protected:
     static bool cleanseCalled_;
+    static size_t cleanseSize_;
 
     void SetUp() override
     {
         cleanseCalled_ = false;
+        cleanseSize_ = 0;
     }
 
-    static void cleanseCalled(void*, size_t) noexcept
+    static void cleanseCalled(void*, size_t n) noexcept
     {
         cleanseCalled_ = true;
+        cleanseSize_ = n;
     }
 };
 template <typename T> bool CleanseTest<T>::cleanseCalled_;
+template <typename T> size_t CleanseTest<T>::cleanseSize_;
 TYPED_TEST_SUITE_P(CleanseTest);
 
 TYPED_TEST_P(CleanseTest, DeallocateShouldCallCleanse)
@@ -47,6 +53,16 @@ TYPED_TEST_P(CleanseTest, DeallocateShouldCallCleanse)
     EXPECT_TRUE(CleanseTest<TypeParam>::cleanseCalled_);
 }
 
+TYPED_TEST_P(CleanseTest, DeallocateShouldCleanseWholeBlock)
+{
+    sanitizing_allocator_base<TypeParam, std::allocator, &CleanseTest<TypeParam>::cleanseCalled> allocator;
+
+    TypeParam* p = allocator.allocate(5);
+    allocator.deallocate(p, 5);
+
+    EXPECT_EQ(CleanseTest<TypeParam>::cleanseSize_, 5 * sizeof(TypeParam));
+}
+
 
 template <typename T>
 class SanitizingAllocatorTest : public testing::Test {
@@ -75,9 +91,165 @@ TYPED_TEST_P(SanitizingAllocatorTest, CleanseShouldSetDataToNulls)
     this->allocator_->deallocate(ptr, count);
 }
 
-REGISTER_TYPED_TEST_SUITE_P(CleanseTest, DeallocateShouldCallCleanse);
+REGISTER_TYPED_TEST_SUITE_P(CleanseTest, DeallocateShouldCallCleanse, DeallocateShouldCleanseWholeBlock);
 REGISTER_TYPED_TEST_SUITE_P(SanitizingAllocatorTest, CleanseShouldSetDataToNulls);
 
 using TestingTypes = ::testing::Types<uint8_t, uint16_t, uint32_t, uint64_t, float, double>;
 INSTANTIATE_TYPED_TEST_SUITE_P(NumericInstantiation, CleanseTest, TestingTypes);
 INSTANTIATE_TYPED_TEST_SUITE_P(NumericInstantiation, SanitizingAllocatorTest, TestingTypes);
+
+
+TEST(ZeroedAllocationTest, DefaultAllocatorShouldNotAdvertiseZeroedBlocks)
+{
+    EXPECT_FALSE(sanitizing_allocator<uint8_t>::allocates_zeroed);
+}
+
+TEST(ZeroedAllocationTest, CallocAllocatorShouldReturnZeroedBlocks)
+{
+    zeroed_sanitizing_allocator<uint64_t> allocator;
+    EXPECT_TRUE(decltype(allocator)::allocates_zeroed);
+
+    uint64_t* p = allocator.allocate(1024);
+    EXPECT_THAT(p, EachIsZero(1024));
+    allocator.deallocate(p, 1024);
+}
+
+TEST(ZeroedAllocationTest, PoolShouldClearBlocksReleasedWithoutWipe)
+{
+    pool_allocator<uint64_t> allocator;
+
+    uint64_t* p = allocator.allocate(4);
+    std::fill(p, p + 4, 0xffffffffffffffff);
+    allocator.deallocate(p, 4);
+
+    uint64_t* reused = allocator.allocate(4);
+    EXPECT_THAT(reused, EachIsZero(4));
+    allocator.deallocate(reused, 4);
+}
+
+TEST(ZeroedAllocationTest, PoolShouldReturnZeroedBlocksAfterSanitizedRelease)
+{
+    pooled_sanitizing_allocator<uint64_t> allocator;
+    EXPECT_TRUE(decltype(allocator)::allocates_zeroed);
+
+    uint64_t* p = allocator.allocate(4);
+    std::fill(p, p + 4, 0xffffffffffffffff);
+    allocator.deallocate(p, 4);
+
+    uint64_t* reused = allocator.allocate(4);
+    EXPECT_THAT(reused, EachIsZero(4));
+    allocator.deallocate(reused, 4);
+}
+
+
+struct counting_policy {
+    static inline size_t wipedBytes = 0;
+    static inline size_t elementSize = 0;
+
+    template <typename T>
+    static void wipe(T* p, size_t n) noexcept
+    {
+        wipedBytes = n * sizeof(T);
+        elementSize = sizeof(T);
+        burn(p, n * sizeof(T));
+    }
+};
+
+TEST(WipePolicyTest, CustomPolicyShouldReceiveElementType)
+{
+    sanitizing_allocator_base<uint32_t, std::allocator, counting_policy{}> allocator;
+
+    uint32_t* p = allocator.allocate(6);
+    allocator.deallocate(p, 6);
+
+    EXPECT_EQ(counting_policy::wipedBytes, 6 * sizeof(uint32_t));
+    EXPECT_EQ(counting_policy::elementSize, sizeof(uint32_t));
+}
+
+TEST(WipePolicyTest, PatternFillShouldFillWithPattern)
+{
+    using Allocator = sanitizing_allocator_base<uint8_t, std::allocator, pattern_fill<0xa5>{}>;
+    uint8_t buffer[16] = { 1, 2, 3 };
+
+    Allocator::sanitize(buffer, sizeof(buffer));
+    EXPECT_TRUE(std::all_of(buffer, buffer + sizeof(buffer), [](uint8_t b) { return b == 0xa5; }));
+}
+
+TEST(WipePolicyTest, NoWipeShouldKeepData)
+{
+    using Allocator = sanitizing_allocator_base<uint8_t, std::allocator, no_wipe{}>;
+    uint8_t buffer[4] = { 1, 2, 3, 4 };
+
+    Allocator::sanitize(buffer, sizeof(buffer));
+    EXPECT_EQ(buffer[3], 4);
+}
+
+TEST(WipePolicyTest, WipeAndFlushShouldZeroData)
+{
+    using Allocator = sanitizing_allocator_base<uint64_t, std::allocator, wipe_and_flush<>{}>;
+    uint64_t buffer[33];
+    fillData(buffer, 33);
+
+    Allocator::sanitize(buffer, 33);
+    EXPECT_THAT(buffer, EachIsZero(33));
+}
+
+TEST(WipePolicyTest, SwitchAtShouldPickPolicyBySize)
+{
+    using Policy = switch_at<16, pattern_fill<0xa5>, zero_fill>;
+    uint8_t small[8] = { 1 };
+    uint8_t large[16] = { 1 };
+
+    Policy::wipe(small, sizeof(small));
+    Policy::wipe(large, sizeof(large));
+
+    EXPECT_EQ(small[0], 0xa5);
+    EXPECT_EQ(large[0], 0);
+}
+
+static void leaveAsIs(void*, size_t) noexcept
+{}
+
+TEST(WipePolicyTest, OnlyZeroFillingPoliciesShouldAllowZeroedReuse)
+{
+    EXPECT_TRUE(wipe_policy_zero_fills<zero_fill>);
+    EXPECT_TRUE(wipe_policy_zero_fills<cleanse_with<&burn>>);
+    EXPECT_TRUE(wipe_policy_zero_fills<wipe_and_flush<zero_fill>>);
+    EXPECT_FALSE(wipe_policy_zero_fills<pattern_fill<0xa5>>);
+    EXPECT_FALSE(wipe_policy_zero_fills<no_wipe>);
+    EXPECT_FALSE(wipe_policy_zero_fills<cleanse_with<&leaveAsIs>>);
+
+    sanitizing_allocator_base<uint64_t, pool_allocator, pattern_fill<0xa5>{}> allocator;
+    uint64_t* p = allocator.allocate(4);
+    allocator.deallocate(p, 4);
+
+    uint64_t* reused = allocator.allocate(4);
+    EXPECT_THAT(reused, EachIsZero(4));
+    allocator.deallocate(reused, 4);
+}
+
+TEST(WipePolicyTest, BurnAndFlushShouldWipeOnlyTheRange)
+{
+    std::vector<uint8_t> buffer(3 * 4096 + 300, 0xa5);
+    size_t offset = 77;
+    size_t length = buffer.size() - offset - 150;
+
+    burn_and_flush(buffer.data() + offset, length);
+
+    EXPECT_EQ(buffer[offset - 1], 0xa5);
+    EXPECT_THAT(buffer.data() + offset, EachIsZero(length));
+    EXPECT_EQ(buffer[offset + length], 0xa5);
+}
+
+TEST(WipePolicyTest, EvictingAllocatorShouldZeroData)
+{
+    uint64_t buffer[100];
+    fillData(buffer, 100);
+
+    evicting_sanitizing_allocator<uint64_t>::sanitize(buffer, 100);
+    EXPECT_THAT(buffer, EachIsZero(100));
+
+    fillData(buffer, 100);
+    wipe_and_write_back<>::wipe(buffer, 100);
+    EXPECT_THAT(buffer, EachIsZero(100));
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cpp_sc/sanitizing_memory_resource.h>
+
+class RecordingResource : public std::pmr::memory_resource {
+public:
+    size_t deallocations = 0;
+    size_t wipedBlocks = 0;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        ++deallocations;
+        auto* data = static_cast<const uint8_t*>(p);
+        if (std::all_of(data, data + bytes, [](uint8_t b) { return b == 0; }))
+            ++wipedBlocks;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+
+TEST(SanitizingMemoryResourceTest, DeallocatedBlocksShouldBeWiped)
+{
+    RecordingResource upstream;
+    sanitizing_memory_resource resource(&upstream);
+
+    void* p = resource.allocate(64);
+    std::memset(p, 0xff, 64);
+    resource.deallocate(p, 64);
+
+    EXPECT_EQ(upstream.deallocations, 1u);
+    EXPECT_EQ(upstream.wipedBlocks, 1u);
+}
+
+TEST(SanitizingMemoryResourceTest, PmrVectorShouldAllocateFromResource)
+{
+    RecordingResource upstream;
+    sanitizing_memory_resource resource(&upstream);
+
+    {
+        pmr::vector_secure<uint8_t> vec(&resource);
+        vec.assign(100, 0xff);
+    }
+
+    EXPECT_EQ(upstream.deallocations, 1u);
+    EXPECT_EQ(upstream.wipedBlocks, 1u);
+}
+
+TEST(SanitizingMemoryResourceTest, PmrVectorShouldWipeOnPlainResource)
+{
+    RecordingResource resource;
+
+    {
+        pmr::vector_secure<uint8_t> vec(&resource);
+        vec.assign(100, 0xff);
+    }
+
+    EXPECT_EQ(resource.deallocations, 1u);
+    EXPECT_EQ(resource.wipedBlocks, 1u);
+}
+
+TEST(SanitizingMemoryResourceTest, PmrVectorShouldWipeOnPoolOverSanitizingResource)
+{
+    RecordingResource upstream;
+    sanitizing_memory_resource resource(&upstream);
+    std::pmr::unsynchronized_pool_resource pool(&resource);
+
+    uint8_t* data;
+    {
+        pmr::vector_secure<uint8_t> vec(&pool);
+        vec.assign(100, 0xff);
+        data = vec.data();
+    }
+
+    // the pool keeps the block for reuse, it must already be clean
+    EXPECT_TRUE(std::all_of(data, data + 100, [](uint8_t b) { return b == 0; }));
+}
+
+TEST(SanitizingMemoryResourceTest, PmrCopyShouldStayOnSourceResource)
+{
+    sanitizing_memory_resource resource;
+    pmr::vector_secure<uint8_t> vec({ 1, 2, 3 }, &resource);
+
+    auto copied = pmr::vector_secure<uint8_t>::copy(vec);
+
+    EXPECT_EQ(copied.get_allocator().resource(), &resource);
+}
+
+TEST(SanitizingMemoryResourceTest, ArenaShouldWipeChunksOnRelease)
+{
+    RecordingResource upstream;
+
+    {
+        sanitizing_arena arena(&upstream);
+
+        pmr::string_secure str("a secret that does not fit into sso", &arena);
+        pmr::vector_secure<uint32_t> vec(&arena);
+        vec.assign(1000, 0xffffffff);
+    }
+
+    EXPECT_GT(upstream.deallocations, 0u);
+    EXPECT_EQ(upstream.wipedBlocks, upstream.deallocations);
+}
+
+TEST(SanitizingMemoryResourceTest, ArenaShouldWipeInitialBuffer)
+{
+    alignas(std::max_align_t) uint8_t buffer[256];
+
+    {
+        sanitizing_arena arena(buffer, sizeof(buffer));
+        pmr::vector_secure<uint8_t> vec(&arena);
+        vec.assign(64, 0xff);
+    }
+
+    EXPECT_TRUE(std::all_of(std::begin(buffer), std::end(buffer), [](uint8_t b) { return b == 0; }));
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <cpp_sc/sealed_secure.h>
+#include <cpp_sc/basic_string_secure.h>
+#include <cpp_sc/vector_secure.h>
+
+using sealed_key = sealed_secure<vector_secure<uint8_t>>;
+using sealed_string = sealed_secure<basic_string_secure<char>>;
+
+static vector_secure<uint8_t> makeKey(size_t size)
+{
+    vector_secure<uint8_t> key(size);
+    for (size_t i = 0; i < size; ++i)
+        key[i] = uint8_t(i + 1);
+    return key;
+}
+
+TEST(SealedSecureTest, ShouldNotKeepPlaintext)
+{
+    vector_secure<uint8_t> plain = makeKey(32);
+    sealed_key sealed(makeKey(32));
+
+    ASSERT_EQ(sealed.size(), 32);
+    EXPECT_NE(sealed.sealed_data(), plain);
+}
+
+TEST(SealedSecureTest, UnsealShouldRestoreContents)
+{
+    sealed_key sealed(makeKey(100));
+
+    auto plain = std::as_const(sealed).unseal();
+    EXPECT_EQ(*plain, makeKey(100));
+}
+
+TEST(SealedSecureTest, ConstUnsealShouldLeaveCiphertext)
+{
+    sealed_key sealed(makeKey(32));
+    vector_secure<uint8_t> before = vector_secure<uint8_t>::copy(sealed.sealed_data());
+
+    {
+        auto plain = std::as_const(sealed).unseal();
+        EXPECT_EQ(plain->size(), 32);
+    }
+    EXPECT_EQ(sealed.sealed_data(), before);
+}
+
+TEST(SealedSecureTest, MutableUnsealShouldResealUnderFreshNonce)
+{
+    sealed_key sealed(makeKey(32));
+    vector_secure<uint8_t> before = vector_secure<uint8_t>::copy(sealed.sealed_data());
+
+    {
+        auto plain = sealed.unseal();
+        (*plain)[0] = 0xff;
+        plain->push_back(0x42);
+    }
+    EXPECT_EQ(sealed.size(), 33);
+    EXPECT_FALSE(std::equal(before.begin() + 1, before.end(), sealed.sealed_data().begin() + 1));
+
+    vector_secure<uint8_t> expected = makeKey(32);
+    expected[0] = 0xff;
+    expected.push_back(0x42);
+    EXPECT_EQ(*std::as_const(sealed).unseal(), expected);
+}
+
+TEST(SealedSecureTest, ShouldSealShortAndLongStrings)
+{
+    for (const char* text : { "short", "a string longer than the inline buffer" }) {
+        sealed_string sealed{basic_string_secure<char>(text)};
+
+        EXPECT_NE(sealed.sealed_data(), text);
+        EXPECT_EQ(*std::as_const(sealed).unseal(), text);
+    }
+}
+
+TEST(SealedSecureTest, CopyAndMoveShouldKeepContents)
+{
+    sealed_key sealed(makeKey(48));
+    sealed_key copy = sealed_key::copy(sealed);
+    sealed_key moved = std::move(sealed);
+
+    EXPECT_EQ(*std::as_const(copy).unseal(), makeKey(48));
+    EXPECT_EQ(*std::as_const(moved).unseal(), makeKey(48));
+}
+
+TEST(SealedSecureTest, EmptyContainerShouldRoundTrip)
+{
+    sealed_key sealed;
+    EXPECT_TRUE(sealed.empty());
+
+    sealed.unseal()->push_back(7);
+    auto plain = std::as_const(sealed).unseal();
+    ASSERT_EQ(plain->size(), 1);
+    EXPECT_EQ(plain->front(), 7);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(SealedSecureTest, ForkedChildShouldUnsealInheritedContents)
+{
+    sealed_key sealed(makeKey(32));
+
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        bool ok = *std::as_const(sealed).unseal() == makeKey(32);
+        { auto reseal = sealed.unseal(); }
+        ok = ok && *std::as_const(sealed).unseal() == makeKey(32);
+        _exit(ok ? 0 : 1);
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+TEST(SealedSecureTest, ForkedChildShouldReseedNonceCounter)
+{
+    // sets up the nonce state before the fork
+    uint8_t first[CHACHA20_NONCE_SIZE];
+    next_seal_nonce(first);
+
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        uint8_t nonce[CHACHA20_NONCE_SIZE];
+        next_seal_nonce(nonce);
+        bool written = write(fds[1], nonce, sizeof(nonce)) == sizeof(nonce);
+        _exit(written ? 0 : 1);
+    }
+
+    uint8_t parent[CHACHA20_NONCE_SIZE];
+    uint8_t child[CHACHA20_NONCE_SIZE];
+    next_seal_nonce(parent);
+    ASSERT_EQ(read(fds[0], child, sizeof(child)), ssize_t(sizeof(child)));
+    close(fds[0]);
+    close(fds[1]);
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+
+    // the counter follows the 32-bit prefix
+    EXPECT_FALSE(std::equal(parent + 4, parent + 12, child + 4));
+}
+#endif
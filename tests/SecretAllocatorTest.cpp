@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <cpp_sc/secret_allocator.h>
+#include <cpp_sc/basic_string_secure.h>
+#include <cpp_sc/vector_secure.h>
+
+#include "testUtils.h"
+
+
+TEST(SecretAllocatorTest, ShouldReportMemoryKind)
+{
+    secret_memory kind = secret_memory_kind();
+    EXPECT_TRUE(kind == secret_memory::memfd_secret ||
+                kind == secret_memory::locked ||
+                kind == secret_memory::unlocked);
+}
+
+TEST(SecretAllocatorTest, BlocksShouldBeZeroedAndAligned)
+{
+    struct alignas(64) wide { unsigned char bytes[64]; };
+
+    secret_allocator<wide> alloc;
+    wide* p = alloc.allocate(3);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % 64, 0u);
+    EXPECT_TRUE(allBytesAre(p, 3 * sizeof(wide), 0));
+
+    alloc.deallocate(p, 3);
+}
+
+TEST(SecretAllocatorTest, ReusedBlockShouldKeepLargerAlignment)
+{
+    // leaves the bump position off a 64-byte boundary
+    void* small = secret_allocate(16, 1);
+
+    void* p = secret_allocate(64, 1);
+    secret_deallocate(p, 64, 1);
+
+    void* q = secret_allocate(64, 64);
+    EXPECT_EQ(p, q);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(q) % 64, 0u);
+
+    secret_deallocate(q, 64, 64);
+    secret_deallocate(small, 16, 1);
+}
+
+TEST(SecretAllocatorTest, DirtyBlockShouldBeClearedOnReuse)
+{
+    secret_allocator<uint8_t> alloc;
+    uint8_t* p = alloc.allocate(100);
+    std::memset(p, 0xa5, 100);
+    alloc.deallocate(p, 100);
+
+    uint8_t* q = alloc.allocate(100);
+    EXPECT_EQ(p, q);
+    EXPECT_TRUE(allBytesAre(q, 100, 0));
+    alloc.deallocate(q, 100);
+}
+
+TEST(SecretAllocatorTest, LargeBlockShouldGetItsOwnRegion)
+{
+    secret_allocator<uint8_t> alloc;
+    size_t size = SECRET_MAX_BLOCK_SIZE + 1;
+    uint8_t* p = alloc.allocate(size);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % page_size(), 0u);
+    EXPECT_TRUE(allBytesAre(p, size, 0));
+    std::memset(p, 0xa5, size);
+
+    alloc.deallocate(p, size);
+}
+
+TEST(SecretAllocatorTest, PoolShouldGrowBeyondInitialRegions)
+{
+    secret_allocator<uint8_t> alloc;
+    std::vector<uint8_t*> blocks;
+    size_t count = SECRET_INITIAL_REGIONS * SECRET_REGION_SIZE / SECRET_MAX_BLOCK_SIZE + 4;
+
+    for (size_t i = 0; i < count; ++i) {
+        blocks.push_back(alloc.allocate(SECRET_MAX_BLOCK_SIZE));
+        blocks.back()[SECRET_MAX_BLOCK_SIZE - 1] = uint8_t(i);
+    }
+    for (size_t i = 0; i < count; ++i)
+        EXPECT_EQ(blocks[i][SECRET_MAX_BLOCK_SIZE - 1], uint8_t(i));
+
+    for (uint8_t* p : blocks)
+        alloc.deallocate(p, SECRET_MAX_BLOCK_SIZE);
+}
+
+TEST(SecretAllocatorTest, SecureContainersShouldWorkOnSecretMemory)
+{
+    using secret_string = basic_string_secure<char, secret_sanitizing_allocator<char>>;
+
+    secret_string str = "0123456789abcdef0123456789abcdef";
+    str += str;
+    EXPECT_EQ(str.size(), 64u);
+
+    vector_secure<int, secret_sanitizing_allocator<int>> vec;
+    for (int i = 0; i < 10000; ++i)
+        vec.push_back(i);
+    EXPECT_EQ(vec[9999], 9999);
+}
+
+TEST(SecretAllocatorTest, ConcurrentAllocationsShouldNotOverlap)
+{
+    constexpr int THREADS = 4;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([t] {
+            secret_allocator<uint8_t> alloc;
+            for (int i = 0; i < 1000; ++i) {
+                size_t size = 16 + (i % 7) * 40;
+                uint8_t* p = alloc.allocate(size);
+                std::memset(p, t + 1, size);
+                ASSERT_TRUE(allBytesAre(p, size, uint8_t(t + 1)));
+                alloc.deallocate(p, size);
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+}
+
+#if defined(__linux__)
+TEST(SecretAllocatorTest, ForkedChildShouldNotSeeBlockContents)
+{
+    secret_allocator<uint8_t> alloc;
+    uint8_t* p = alloc.allocate(100);
+    std::memset(p, 0xa5, 100);
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0)
+        _exit(allBytesAre(p, 100, 0) ? 0 : 1); // memfd_secret: not mapped, faults instead
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    EXPECT_TRUE(WIFSIGNALED(status) || (WIFEXITED(status) && WEXITSTATUS(status) == 0));
+
+    alloc.deallocate(p, 100);
+}
+#endif
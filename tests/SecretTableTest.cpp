@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <vector>
+
+#include <secret_scan.h>
+#include <cpp_sc/secret_table.h>
+
+using Key = std::array<uint8_t, 32>;
+
+static Key makeKey(uint8_t seed)
+{
+    Key key;
+    for (size_t i = 0; i < key.size(); ++i)
+        key[i] = uint8_t(seed * 31 + i);
+    return key;
+}
+
+
+TEST(SecretScanTest, ShouldFindOnlyOccupiedMatchingSlots)
+{
+    for (size_t width : { 1, 7, 16, 32, 45, 64, 100 }) {
+        std::vector<uint8_t> slots(8 * width);
+        for (size_t i = 0; i < slots.size(); ++i)
+            slots[i] = uint8_t(i / width);
+        std::vector<uint32_t> generations = { 1, 1, 1, 2, 1, 1, 1, 1 };
+
+        std::vector<uint8_t> secret(width, 5);
+        EXPECT_EQ(find_secret_slot(slots.data(), generations.data(), 8, width, secret.data()), 5u) << width;
+
+        secret.assign(width, 3); // freed slot
+        EXPECT_EQ(find_secret_slot(slots.data(), generations.data(), 8, width, secret.data()),
+                  SECRET_SLOT_NOT_FOUND) << width;
+
+        secret.assign(width, 5);
+        secret[width - 1] = 0xff; // last byte differs
+        EXPECT_EQ(find_secret_slot(slots.data(), generations.data(), 8, width, secret.data()),
+                  SECRET_SLOT_NOT_FOUND) << width;
+    }
+}
+
+
+TEST(SecretTableTest, InsertedSecretsShouldBeReadableByHandle)
+{
+    secret_table<32> table;
+    auto a = table.insert(makeKey(1));
+    auto b = table.insert(makeKey(2));
+
+    EXPECT_EQ(table.size(), 2u);
+    EXPECT_TRUE(std::ranges::equal(table.at(a), makeKey(1)));
+    EXPECT_TRUE(std::ranges::equal(table.at(b), makeKey(2)));
+}
+
+TEST(SecretTableTest, HandlesShouldSurviveGrowth)
+{
+    secret_table<32> table(1);
+    std::vector<secret_table<32>::handle> handles;
+    for (uint8_t i = 0; i < 100; ++i)
+        handles.push_back(table.insert(makeKey(i)));
+
+    EXPECT_GE(table.capacity(), 100u);
+    for (uint8_t i = 0; i < 100; ++i)
+        ASSERT_TRUE(std::ranges::equal(table.at(handles[i]), makeKey(i)));
+}
+
+TEST(SecretTableTest, EraseShouldWipeSlotAndInvalidateHandle)
+{
+    secret_table<32> table(4);
+    auto h = table.insert(makeKey(7));
+    const uint8_t* bytes = table.at(h).data();
+
+    EXPECT_TRUE(table.erase(h));
+    EXPECT_FALSE(table.contains(h));
+    EXPECT_FALSE(table.erase(h));
+    EXPECT_THROW(table.at(h), std::out_of_range);
+    EXPECT_EQ(table.size(), 0u);
+
+    for (size_t i = 0; i < 32; ++i)
+        ASSERT_EQ(bytes[i], 0) << "byte " << i << " is not wiped";
+}
+
+TEST(SecretTableTest, StaleHandleShouldBeRejectedAfterSlotReuse)
+{
+    secret_table<32> table(1);
+    auto old = table.insert(makeKey(1));
+    table.erase(old);
+    auto reused = table.insert(makeKey(2));
+
+    EXPECT_EQ(old.index, reused.index);
+    EXPECT_FALSE(table.contains(old));
+    EXPECT_TRUE(table.contains(reused));
+    EXPECT_EQ(table.capacity(), 1u);
+}
+
+TEST(SecretTableTest, FindShouldReturnHandleOfMatchingSecret)
+{
+    secret_table<32> table;
+    std::vector<secret_table<32>::handle> handles;
+    for (uint8_t i = 0; i < 50; ++i)
+        handles.push_back(table.insert(makeKey(i)));
+
+    auto found = table.find(makeKey(42));
+    ASSERT_TRUE(found);
+    EXPECT_EQ(*found, handles[42]);
+
+    table.erase(handles[42]);
+    EXPECT_FALSE(table.find(makeKey(42)));
+    EXPECT_FALSE(table.find(makeKey(200)));
+}
+
+TEST(SecretTableTest, FindShouldWorkForOddWidths)
+{
+    secret_table<5> table;
+    table.insert(std::array<uint8_t, 5>{ 1, 2, 3, 4, 5 });
+    auto h = table.insert(std::array<uint8_t, 5>{ 5, 4, 3, 2, 1 });
+
+    auto found = table.find(std::array<uint8_t, 5>{ 5, 4, 3, 2, 1 });
+    ASSERT_TRUE(found);
+    EXPECT_EQ(*found, h);
+}
+
+TEST(SecretTableTest, ClearShouldWipeAllSlotsAndKeepCapacity)
+{
+    secret_table<32> table(8);
+    std::vector<secret_table<32>::handle> handles;
+    for (uint8_t i = 0; i < 8; ++i)
+        handles.push_back(table.insert(makeKey(i + 1)));
+    const uint8_t* bytes = table.at(handles[0]).data();
+
+    table.clear();
+
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.capacity(), 8u);
+    for (auto h : handles)
+        EXPECT_FALSE(table.contains(h));
+    for (size_t i = 0; i < 8 * 32; ++i)
+        ASSERT_EQ(bytes[i], 0) << "byte " << i << " is not wiped";
+
+    auto h = table.insert(makeKey(1));
+    EXPECT_EQ(h.index, 0u);
+    EXPECT_EQ(table.at(h).data(), bytes);
+}
+
+TEST(SecretTableTest, MoveShouldTransferSecrets)
+{
+    secret_table<32> table;
+    auto h = table.insert(makeKey(3));
+
+    secret_table<32> moved(std::move(table));
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(moved.size(), 1u);
+    EXPECT_TRUE(std::ranges::equal(moved.at(h), makeKey(3)));
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <thread>
+
+#include <cpp_sc/secure_channel.h>
+#include <cpp_sc/basic_string_secure.h>
+
+static const char* _16SymbolsString = "0123456789abcdef";
+
+
+TEST(SecureChannelTest, CapacityShouldBeRoundedUpToPowerOfTwo)
+{
+    secure_channel<string_secure> channel(5);
+    EXPECT_EQ(channel.capacity(), 8u);
+}
+
+TEST(SecureChannelTest, PushShouldMoveOwnershipIntoChannel)
+{
+    secure_channel<string_secure> channel(4);
+    string_secure str = _16SymbolsString;
+    const char* ptr = str.data();
+
+    ASSERT_TRUE(channel.try_push(std::move(str)));
+    EXPECT_TRUE(str.empty());
+
+    string_secure popped;
+    ASSERT_TRUE(channel.try_pop(popped));
+    EXPECT_EQ(popped, _16SymbolsString);
+    EXPECT_EQ(popped.data(), ptr);
+}
+
+TEST(SecureChannelTest, PopFromEmptyChannelShouldFail)
+{
+    secure_channel<vector_secure<uint8_t>> channel(4);
+    vector_secure<uint8_t> vec;
+
+    EXPECT_FALSE(channel.try_pop(vec));
+}
+
+TEST(SecureChannelTest, PushIntoFullChannelShouldFail)
+{
+    secure_channel<vector_secure<uint8_t>> channel(2);
+
+    EXPECT_TRUE(channel.try_push(vector_secure<uint8_t>{ 1 }));
+    EXPECT_TRUE(channel.try_push(vector_secure<uint8_t>{ 2 }));
+
+    vector_secure<uint8_t> rejected = { 3 };
+    EXPECT_FALSE(channel.try_push(std::move(rejected)));
+    EXPECT_EQ(rejected.size(), 1u);
+}
+
+TEST(SecureChannelTest, ElementsShouldBePoppedInFifoOrder)
+{
+    secure_channel<vector_secure<int>> channel(8);
+    for (int i = 0; i < 8; ++i)
+        ASSERT_TRUE(channel.try_push(vector_secure<int>{ i }));
+
+    vector_secure<int> vec;
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_TRUE(channel.try_pop(vec));
+        EXPECT_EQ(vec.front(), i);
+    }
+}
+
+TEST(SecureChannelTest, BatchOperationsShouldMoveAsManyElementsAsFit)
+{
+    secure_channel<string_secure> channel(4);
+    std::vector<string_secure> input;
+    for (int i = 0; i < 6; ++i)
+        input.emplace_back(string_secure(16, char('a' + i)));
+
+    EXPECT_EQ(channel.try_push_batch(input.begin(), input.size()), 4u);
+    EXPECT_TRUE(input[0].empty());
+    EXPECT_FALSE(input[4].empty());
+
+    std::vector<string_secure> output(6);
+    EXPECT_EQ(channel.try_pop_batch(output.begin(), output.size()), 4u);
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(output[i], string_secure(16, char('a' + i)));
+}
+
+TEST(SecureChannelTest, ConcurrentProducersAndConsumersShouldTransferEveryElement)
+{
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 10000;
+
+    secure_channel<vector_secure<int>> channel(64);
+    std::atomic<long long> sum = 0;
+    std::atomic<int> received = 0;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        threads.emplace_back([&channel, p] {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                vector_secure<int> vec = { p * PER_PRODUCER + i };
+                while (!channel.try_push(std::move(vec)))
+                    std::this_thread::yield();
+            }
+        });
+        threads.emplace_back([&] {
+            vector_secure<int> batch[8];
+            while (received.load() < PRODUCERS * PER_PRODUCER) {
+                size_t n = channel.try_pop_batch(batch, 8);
+                for (size_t i = 0; i < n; ++i)
+                    sum += batch[i].front();
+                received += int(n);
+                if (n == 0)
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    long long total = PRODUCERS * PER_PRODUCER;
+    EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <string>
+
+#include <cpp_sc/secure_encoding.h>
+#include <cpp_sc/secure_random.h>
+
+static vector_secure<uint8_t> bytesOf(std::string_view s)
+{
+    return vector_secure<uint8_t>::copy(s.begin(), s.end());
+}
+
+// Straightforward encoders to check the vectorized ones against
+static std::string referenceHex(const vector_secure<uint8_t>& bytes)
+{
+    static const char digits[] = "0123456789abcdef";
+    std::string result;
+    for (uint8_t b : bytes) {
+        result += digits[b >> 4];
+        result += digits[b & 0xf];
+    }
+    return result;
+}
+
+static std::string referenceBase64(const vector_secure<uint8_t>& bytes)
+{
+    static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string result;
+    for (size_t i = 0; i < bytes.size(); i += 3) {
+        uint32_t v = uint32_t(bytes[i]) << 16;
+        if (i + 1 < bytes.size())
+            v |= uint32_t(bytes[i + 1]) << 8;
+        if (i + 2 < bytes.size())
+            v |= bytes[i + 2];
+
+        result += digits[v >> 18];
+        result += digits[v >> 12 & 0x3f];
+        result += i + 1 < bytes.size() ? digits[v >> 6 & 0x3f] : '=';
+        result += i + 2 < bytes.size() ? digits[v & 0x3f] : '=';
+    }
+    return result;
+}
+
+TEST(SecureEncodingTest, Base64ShouldMatchRfc4648)
+{
+    const std::pair<const char*, const char*> vectors[] = {
+        { "", "" }, { "f", "Zg==" }, { "fo", "Zm8=" }, { "foo", "Zm9v" },
+        { "foob", "Zm9vYg==" }, { "fooba", "Zm9vYmE=" }, { "foobar", "Zm9vYmFy" }
+    };
+
+    for (auto [plain, encoded] : vectors) {
+        EXPECT_EQ(std::string_view(base64_encode(bytesOf(plain))), encoded);
+        EXPECT_EQ(base64_decode(encoded), bytesOf(plain));
+    }
+}
+
+TEST(SecureEncodingTest, HexShouldEncodeEveryByte)
+{
+    vector_secure<uint8_t> bytes(256);
+    for (size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = uint8_t(i);
+
+    string_secure hex = hex_encode(bytes);
+    EXPECT_EQ(std::string_view(hex), referenceHex(bytes));
+    EXPECT_EQ(hex_decode(hex), bytes);
+}
+
+TEST(SecureEncodingTest, ShouldMatchReferenceAtEveryLength)
+{
+    for (size_t size = 0; size < 200; ++size) {
+        auto bytes = secure_random::generate<vector_secure<uint8_t>>(size);
+
+        string_secure hex = hex_encode(bytes);
+        string_secure base64 = base64_encode(bytes);
+        ASSERT_EQ(std::string_view(hex), referenceHex(bytes)) << size;
+        ASSERT_EQ(std::string_view(base64), referenceBase64(bytes)) << size;
+
+        EXPECT_EQ(hex_decode(hex), bytes) << size;
+        EXPECT_EQ(base64_decode(base64), bytes) << size;
+    }
+}
+
+TEST(SecureEncodingTest, HexDecodeShouldAcceptUpperCase)
+{
+    EXPECT_EQ(hex_decode("DEADbeef00FF"), bytesOf(std::string_view("\xde\xad\xbe\xef\x00\xff", 6)));
+}
+
+TEST(SecureEncodingTest, InvalidHexShouldThrow)
+{
+    EXPECT_THROW(hex_decode("abc"), std::invalid_argument);
+    EXPECT_THROW(hex_decode("0g"), std::invalid_argument);
+    EXPECT_THROW(hex_decode("0:"), std::invalid_argument);
+
+    std::string longInput(64, 'a');
+    longInput[40] = 'x';
+    EXPECT_THROW(hex_decode(longInput), std::invalid_argument);
+    longInput[40] = '\xc1';
+    EXPECT_THROW(hex_decode(longInput), std::invalid_argument);
+}
+
+TEST(SecureEncodingTest, InvalidBase64ShouldThrow)
+{
+    EXPECT_THROW(base64_decode("Zm9"), std::invalid_argument);
+    EXPECT_THROW(base64_decode("Zm9-"), std::invalid_argument);
+    EXPECT_THROW(base64_decode("Z=9v"), std::invalid_argument);
+    EXPECT_THROW(base64_decode("Zm=v"), std::invalid_argument);
+    EXPECT_THROW(base64_decode("===="), std::invalid_argument);
+
+    std::string longInput(64, 'A');
+    longInput[10] = '=';
+    EXPECT_THROW(base64_decode(longInput), std::invalid_argument);
+    longInput[10] = '\x80';
+    EXPECT_THROW(base64_decode(longInput), std::invalid_argument);
+}
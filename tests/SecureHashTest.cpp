@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <siphash.h>
+#include <cpp_sc/secure_hash.h>
+
+// Reference implementation test vectors: key 00..0f, message 00 01 02 ...
+TEST(SipHashTest, ShouldMatchReferenceVectors)
+{
+    std::array<uint8_t, 16> key;
+    std::array<uint8_t, 64> message;
+    for (size_t i = 0; i < key.size(); ++i)
+        key[i] = uint8_t(i);
+    for (size_t i = 0; i < message.size(); ++i)
+        message[i] = uint8_t(i);
+
+    EXPECT_EQ(siphash24(key.data(), message.data(), 0), 0x726fdb47dd0e0e31u);
+    EXPECT_EQ(siphash24(key.data(), message.data(), 1), 0x74f839c593dc67fdu);
+    EXPECT_EQ(siphash24(key.data(), message.data(), 7), 0xab0200f58b01d137u);
+    EXPECT_EQ(siphash24(key.data(), message.data(), 8), 0x93f5f5799a932462u);
+    EXPECT_EQ(siphash24(key.data(), message.data(), 15), 0xa129ca6149be45e5u);
+    EXPECT_EQ(siphash24(key.data(), message.data(), 63), 0x958a324ceb064572u);
+}
+
+TEST(SipHashTest, TailShouldDependOnEveryByte)
+{
+    std::array<uint8_t, 16> key = {};
+    for (size_t size = 1; size <= 24; ++size) {
+        std::array<uint8_t, 24> message = {};
+        uint64_t base = siphash24(key.data(), message.data(), size);
+
+        for (size_t i = 0; i < size; ++i) {
+            message[i] = 1;
+            EXPECT_NE(siphash24(key.data(), message.data(), size), base) << size << " " << i;
+            message[i] = 0;
+        }
+    }
+}
+
+TEST(SecureHashTest, EqualContentsShouldHashEqual)
+{
+    string_secure a("a secret key of some length");
+    string_secure b("a secret key of some length");
+
+    secure_hash<string_secure> hash;
+    EXPECT_EQ(hash(a), hash(b));
+    EXPECT_NE(hash(a), hash(string_secure("another key")));
+    EXPECT_EQ(hash(a), secure_hash<std::string_view>()(std::string_view(a)));
+}
+
+TEST(SecureHashTest, ShouldBeKeyedPerProcess)
+{
+    std::array<uint8_t, 16> zeroKey = {};
+    string_secure s("key");
+
+    EXPECT_NE(secure_hash<string_secure>()(s), size_t(siphash24(zeroKey.data(), s.data(), s.size())));
+}
+
+TEST(SecureHashTest, ShouldWorkAsHasherOfUnorderedContainers)
+{
+    std::unordered_set<string_secure, secure_hash<string_secure>> set;
+    set.insert(string_secure("alpha"));
+    set.insert(string_secure("beta"));
+    EXPECT_EQ(set.count(string_secure("alpha")), 1);
+    EXPECT_EQ(set.count(string_secure("gamma")), 0);
+
+    std::unordered_map<vector_secure<uint8_t>, int, secure_hash<vector_secure<uint8_t>>> map;
+    vector_secure<uint8_t> key(4);
+    key[0] = 7;
+    map.emplace(vector_secure<uint8_t>::copy(key), 1);
+    EXPECT_EQ(map.at(key), 1);
+}
+
+TEST(SecureHashTest, TransparentHashShouldAllowLookupByView)
+{
+    std::unordered_map<string_secure, int, secure_hash<>, std::equal_to<>> map;
+    map.emplace(string_secure("token"), 42);
+
+    auto it = map.find(std::string_view("token"));
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, 42);
+    EXPECT_EQ(secure_hash<>()("token"), secure_hash<>()(std::string_view("token")));
+}
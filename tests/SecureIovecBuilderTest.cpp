@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cpp_sc/secure_iovec_builder.h>
+#include <cpp_sc/basic_string_secure.h>
+#include <cpp_sc/vector_secure.h>
+
+class SecureIovecBuilderTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(pipe(fds_), 0);
+    }
+
+    void TearDown() override
+    {
+        close(fds_[0]);
+        if (fds_[1] >= 0)
+            close(fds_[1]);
+    }
+
+    void closeWriteEnd()
+    {
+        close(fds_[1]);
+        fds_[1] = -1;
+    }
+
+    std::string readAll()
+    {
+        std::string result;
+        char buffer[4096];
+        ssize_t n;
+        while ((n = read(fds_[0], buffer, sizeof(buffer))) > 0)
+            result.append(buffer, size_t(n));
+        return result;
+    }
+
+    int fds_[2] = { -1, -1 };
+};
+
+TEST_F(SecureIovecBuilderTest, WriteShouldSendFragmentsInOrder)
+{
+    string_secure user("user");
+    vector_secure<char> password(6, 'p');
+
+    secure_iovec_builder out;
+    out.append(std::string_view("name=")).append(user).append(std::string_view(";")).append(password);
+    EXPECT_EQ(out.fragment_count(), 4);
+    EXPECT_EQ(out.size(), 16);
+
+    EXPECT_EQ(out.write(fds_[1]), 16);
+    closeWriteEnd();
+    EXPECT_EQ(readAll(), "name=user;pppppp");
+}
+
+TEST_F(SecureIovecBuilderTest, EmptyFragmentsShouldBeSkipped)
+{
+    string_secure empty;
+    secure_iovec_builder out;
+    out.append(empty).append(std::string_view("x")).append(empty);
+
+    EXPECT_EQ(out.fragment_count(), 1);
+    EXPECT_EQ(out.write(fds_[1]), 1);
+}
+
+TEST_F(SecureIovecBuilderTest, WriteShouldResumePartialWrites)
+{
+    // more than a pipe buffer, so writev returns early while the reader drains
+    vector_secure<char> first(300 * 1024, 'a');
+    vector_secure<char> second(200 * 1024, 'b');
+    secure_iovec_builder out;
+    out.append(first).append(second);
+
+    std::string received;
+    std::thread reader([&] { received = readAll(); });
+
+    fcntl(fds_[1], F_SETFL, fcntl(fds_[1], F_GETFL) | O_NONBLOCK);
+    EXPECT_EQ(out.write(fds_[1]), first.size() + second.size());
+    closeWriteEnd();
+    reader.join();
+
+    ASSERT_EQ(received.size(), first.size() + second.size());
+    EXPECT_EQ(received.find('b'), first.size());
+    EXPECT_EQ(received.back(), 'b');
+}
+
+TEST_F(SecureIovecBuilderTest, ManyFragmentsShouldBeWrittenInBatches)
+{
+    std::string expected;
+    std::vector<string_secure> parts;
+    for (size_t i = 0; i < 300; ++i) {
+        parts.emplace_back((std::to_string(i) + ",").c_str());
+        expected += std::to_string(i) + ",";
+    }
+
+    secure_iovec_builder out(parts.size());
+    for (const auto& part : parts)
+        out.append(part);
+
+    EXPECT_EQ(out.write(fds_[1]), expected.size());
+    closeWriteEnd();
+    EXPECT_EQ(readAll(), expected);
+}
+
+TEST_F(SecureIovecBuilderTest, SendShouldWriteToSocket)
+{
+    int sockets[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+
+    string_secure secret("secret");
+    secure_iovec_builder out;
+    out.append(secret).append(std::string_view("!"));
+    EXPECT_EQ(out.send(sockets[0]), 7);
+
+    char buffer[16] = {};
+    EXPECT_EQ(read(sockets[1], buffer, sizeof(buffer)), 7);
+    EXPECT_STREQ(buffer, "secret!");
+
+    close(sockets[1]);
+    EXPECT_THROW(out.send(sockets[0]), std::system_error);
+    close(sockets[0]);
+}
+
+TEST_F(SecureIovecBuilderTest, ReadShouldFillSpareCapacityInOrder)
+{
+    ASSERT_EQ(write(fds_[1], "headerbody-bytes", 16), 16);
+
+    string_secure header("h:");
+    header.reserve(8);
+    vector_secure<uint8_t> body;
+    body.reserve(64);
+    size_t headerSpare = header.capacity() - header.size();
+
+    size_t n = read_secure(fds_[0], header, body);
+    EXPECT_EQ(n, 16);
+    EXPECT_EQ(header.size(), 2 + headerSpare);
+    EXPECT_EQ(body.size(), 16 - headerSpare);
+    EXPECT_EQ(std::string(header) + std::string(body.begin(), body.end()), "h:headerbody-bytes");
+}
+
+TEST_F(SecureIovecBuilderTest, ReadShouldKeepSizesAtEndOfFile)
+{
+    closeWriteEnd();
+    vector_secure<uint8_t> buffer;
+    buffer.reserve(32);
+
+    EXPECT_EQ(read_secure(fds_[0], buffer), 0);
+    EXPECT_TRUE(buffer.empty());
+}
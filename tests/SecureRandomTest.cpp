@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <cmath>
+#include <set>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <chacha20.h>
+#include <cpp_sc/secure_random.h>
+#include <cpp_sc/basic_string_secure.h>
+#include <cpp_sc/vector_secure.h>
+
+static std::vector<uint8_t> fromHex(const char* hex)
+{
+    std::vector<uint8_t> bytes;
+    for (; hex[0] && hex[1]; hex += 2)
+        bytes.push_back(uint8_t(std::stoi(std::string(hex, 2), nullptr, 16)));
+    return bytes;
+}
+
+static std::array<uint8_t, 32> rfcKey()
+{
+    std::array<uint8_t, 32> key;
+    for (size_t i = 0; i < key.size(); ++i)
+        key[i] = uint8_t(i);
+    return key;
+}
+
+
+// RFC 8439, 2.3.2
+TEST(ChaCha20Test, BlockShouldMatchRfc8439)
+{
+    auto key = rfcKey();
+    auto nonce = fromHex("000000090000004a00000000");
+    auto expected = fromHex("10f1e7e4d13b5915500fdd1fa32071c4c7d1f4c733c068030422aa9ac3d46c4e"
+                            "d2826446079faa0914c2d705d98b02a2b5129cd1de164eb9cbd083e8a2503c4e");
+
+    std::vector<uint8_t> block(64);
+    chacha20_keystream(key.data(), nonce.data(), 1, block.data(), block.size());
+    EXPECT_EQ(block, expected);
+}
+
+// RFC 8439, 2.4.2
+TEST(ChaCha20Test, EncryptionShouldMatchRfc8439)
+{
+    auto key = rfcKey();
+    auto nonce = fromHex("000000000000004a00000000");
+    std::string plaintext = "Ladies and Gentlemen of the class of '99: If I could offer you only one tip "
+                            "for the future, sunscreen would be it.";
+    auto expected = fromHex("6e2e359a2568f98041ba0728dd0d6981e97e7aec1d4360c20a27afccfd9fae0b"
+                            "f91b65c5524733ab8f593dabcd62b3571639d624e65152ab8f530c359f0861d8"
+                            "07ca0dbf500d6a6156a38e088a22b65e52bc514d16ccf806818ce91ab7793736"
+                            "5af90bbf74a35be6b40b8eedf2785e42874d");
+
+    std::vector<uint8_t> data(plaintext.begin(), plaintext.end());
+    chacha20_xor(key.data(), nonce.data(), 1, data.data(), data.size());
+    EXPECT_EQ(data, expected);
+
+    chacha20_xor(key.data(), nonce.data(), 1, data.data(), data.size());
+    EXPECT_EQ(std::string(data.begin(), data.end()), plaintext);
+}
+
+TEST(ChaCha20Test, KeystreamShouldNotDependOnSplitting)
+{
+    auto key = rfcKey();
+    uint8_t nonce[12] = {};
+    std::vector<uint8_t> whole(64 * 20);
+    std::vector<uint8_t> parts(64 * 20);
+
+    chacha20_keystream(key.data(), nonce, 7, whole.data(), whole.size());
+    chacha20_keystream(key.data(), nonce, 7, parts.data(), 64 * 3);
+    chacha20_keystream(key.data(), nonce, 10, parts.data() + 64 * 3, 64 * 17);
+    EXPECT_EQ(whole, parts);
+}
+
+TEST(ChaCha20Test, ShortRequestsShouldMatchBatchedKeystream)
+{
+    auto key = rfcKey();
+    uint8_t nonce[12] = { 1 };
+    std::vector<uint8_t> stream(64 * 8);
+    chacha20_keystream(key.data(), nonce, 3, stream.data(), stream.size());
+
+    for (size_t size : { 1, 32, 64, 65, 128, 129 }) {
+        std::vector<uint8_t> data(size);
+        chacha20_xor(key.data(), nonce, 3, data.data(), size);
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), stream.begin())) << size;
+
+        chacha20_keystream(key.data(), nonce, 3, data.data(), size);
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), stream.begin())) << size;
+    }
+}
+
+
+TEST(SecureRandomTest, GenerateShouldReturnDistinctKeys)
+{
+    std::set<std::vector<uint8_t>> keys;
+    for (int i = 0; i < 1000; ++i) {
+        auto key = secure_random::generate<vector_secure<uint8_t>>(32);
+        ASSERT_EQ(key.size(), 32u);
+        keys.emplace(key.begin(), key.end());
+    }
+    EXPECT_EQ(keys.size(), 1000u);
+}
+
+TEST(SecureRandomTest, FillShouldAcceptArraysAndStrings)
+{
+    std::array<uint32_t, 8> words = {};
+    secure_random::fill(words);
+    EXPECT_NE(std::count(words.begin(), words.end(), 0u), 8);
+
+    auto str = secure_random::generate<string_secure>(64);
+    EXPECT_EQ(str.size(), 64u);
+}
+
+TEST(SecureRandomTest, FillAcrossReseedShouldWriteEveryByte)
+{
+    vector_secure<uint8_t> data;
+    data.resize(RANDOM_RESEED_INTERVAL + 4096);
+    secure_random::fill(data);
+
+    auto tail = data.end() - 64;
+    EXPECT_NE(std::count(tail, data.end(), uint8_t(0)), 64);
+}
+
+TEST(SecureRandomTest, LargeFillShouldLookUniform)
+{
+    vector_secure<uint8_t> data;
+    data.resize(1024 * 1024 + 100);
+    secure_random::fill(data);
+
+    size_t counts[256] = {};
+    for (uint8_t b : data)
+        ++counts[b];
+
+    // six standard deviations: a uniform source should practically never miss
+    double expected = double(data.size()) / 256;
+    for (size_t count : counts)
+        EXPECT_NEAR(double(count), expected, 6 * std::sqrt(expected));
+}
+
+TEST(SecureRandomTest, ThreadsShouldGetDifferentStreams)
+{
+    std::array<uint8_t, 32> first, second;
+    std::thread([&] { secure_random::fill(first); }).join();
+    std::thread([&] { secure_random::fill(second); }).join();
+
+    EXPECT_NE(first, second);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(SecureRandomTest, ForkedChildShouldNotRepeatParentOutput)
+{
+    std::array<uint8_t, 16> warmup;
+    secure_random::fill(warmup);
+
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        std::array<uint8_t, 32> child;
+        secure_random::fill(child);
+        ssize_t written = write(fds[1], child.data(), child.size());
+        _exit(written == ssize_t(child.size()) ? 0 : 1);
+    }
+
+    std::array<uint8_t, 32> parent, child;
+    secure_random::fill(parent);
+    ASSERT_EQ(read(fds[0], child.data(), child.size()), ssize_t(child.size()));
+    waitpid(pid, nullptr, 0);
+    close(fds[0]);
+    close(fds[1]);
+
+    EXPECT_NE(parent, child);
+}
+#endif
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cpp_sc/secure_split.h>
+
+using testing::ElementsAre;
+
+template <typename CharT>
+static std::vector<std::basic_string<CharT>> collect(secure_split_view<CharT> view)
+{
+    std::vector<std::basic_string<CharT>> pieces;
+    for (auto piece : view)
+        pieces.emplace_back(piece);
+    return pieces;
+}
+
+TEST(SecureSplitTest, ShouldSplitOnCharacter)
+{
+    string_secure line("alpha,beta,,gamma");
+    EXPECT_THAT(collect(secure_split(line, ',')), ElementsAre("alpha", "beta", "", "gamma"));
+}
+
+TEST(SecureSplitTest, EdgeCasesShouldMatchStdSplit)
+{
+    string_secure empty;
+    string_secure trailing("a:");
+    string_secure none("abc");
+
+    EXPECT_TRUE(collect(secure_split(empty, ':')).empty());
+    EXPECT_THAT(collect(secure_split(trailing, ':')), ElementsAre("a", ""));
+    EXPECT_THAT(collect(secure_split(none, ':')), ElementsAre("abc"));
+    EXPECT_THAT(collect(secure_split(none, "")), ElementsAre("abc"));
+}
+
+TEST(SecureSplitTest, ShouldSplitOnString)
+{
+    string_secure jwt("header.payload..signature");
+    EXPECT_THAT(collect(secure_split(jwt, "..")), ElementsAre("header.payload", "signature"));
+
+    string_secure list("a, b, c");
+    EXPECT_THAT(collect(secure_split(list, std::string_view(", "))), ElementsAre("a", "b", "c"));
+}
+
+TEST(SecureSplitTest, PiecesShouldPointIntoSource)
+{
+    string_secure secret("user:password");
+    auto view = secure_split(secret, ':');
+    auto it = view.begin();
+
+    EXPECT_EQ((*it).data(), secret.data());
+    ++it;
+    EXPECT_EQ((*it).data(), secret.data() + 5);
+    ++it;
+    EXPECT_EQ(it, view.end());
+}
+
+TEST(SecureSplitTest, ShouldModelForwardRange)
+{
+    static_assert(std::ranges::forward_range<secure_split_view<char>>);
+    static_assert(std::ranges::view<secure_split_view<char>>);
+
+    string_secure line("k1=v1;k2=v2");
+    auto view = secure_split(line, ';');
+    EXPECT_EQ(std::ranges::distance(view), 2);
+    EXPECT_EQ(std::ranges::distance(view), 2);
+}
+
+TEST(SecureSplitTest, LongInputShouldFindAllDelimiters)
+{
+    string_secure text;
+    std::vector<std::string> expected;
+    for (size_t i = 0; i < 100; ++i) {
+        std::string piece(i * 7 % 50, char('a' + i % 26));
+        text += piece.c_str();
+        text += '|';
+        expected.push_back(piece);
+    }
+    expected.emplace_back();
+
+    EXPECT_EQ(collect(secure_split(text, '|')), expected);
+}
+
+TEST(SecureSplitTest, SplitOnceShouldSeparateKeyAndValue)
+{
+    string_secure credentials("user:pa:ss");
+    auto parts = secure_split_once(credentials, ':');
+
+    ASSERT_TRUE(parts.has_value());
+    EXPECT_EQ(parts->first, "user");
+    EXPECT_EQ(parts->second, "pa:ss");
+
+    string_secure user("user");
+    EXPECT_FALSE(secure_split_once(user, ':').has_value());
+}
+
+TEST(SecureSplitTest, ShouldHandleWideCharacterTypes)
+{
+    wstring_secure wide(L"a;b");
+    u16string_secure utf16(u"a;b");
+    u32string_secure utf32(U"a;b");
+
+    EXPECT_THAT(collect(secure_split(wide, L';')), ElementsAre(L"a", L"b"));
+    EXPECT_THAT(collect(secure_split(utf16, u';')), ElementsAre(u"a", u"b"));
+    EXPECT_THAT(collect(secure_split(utf32, U";")), ElementsAre(U"a", U"b"));
+    EXPECT_EQ(std::u32string_view(secure_join(secure_split(utf32, U';'), U'+')), U"a+b");
+}
+
+TEST(SecureJoinTest, ShouldJoinWithSeparator)
+{
+    std::vector<string_secure> parts;
+    parts.emplace_back("alpha");
+    parts.emplace_back("beta");
+    parts.emplace_back("gamma");
+
+    EXPECT_EQ(secure_join(parts, ", "), "alpha, beta, gamma");
+    EXPECT_EQ(secure_join(parts, '/'), "alpha/beta/gamma");
+}
+
+TEST(SecureJoinTest, ShouldAllocateExactly)
+{
+    std::vector<std::string_view> parts(40, "0123456789");
+    string_secure joined = secure_join(parts, ":");
+
+    EXPECT_EQ(joined.size(), 40 * 10 + 39);
+    EXPECT_EQ(joined.capacity(), joined.size());
+}
+
+TEST(SecureJoinTest, EmptyAndSingleRangesShouldHaveNoSeparator)
+{
+    std::vector<std::string_view> none;
+    std::vector<std::string_view> one = { "only" };
+
+    EXPECT_TRUE(secure_join(none, ",").empty());
+    EXPECT_EQ(secure_join(one, ","), "only");
+}
+
+TEST(SecureJoinTest, SplitAndJoinShouldRoundTrip)
+{
+    string_secure line("a=1&b=2&&c=3&");
+    EXPECT_EQ(secure_join(secure_split(line, '&'), '&'), line);
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cpp_sc/secure_unique_ptr.h>
+#include <cpp_sc/pool_allocator.h>
+
+struct KeySchedule {
+    uint32_t rk[60];
+};
+
+struct Tracked {
+    explicit Tracked(int value, bool* destroyed)
+        : value_(value), destroyed_(destroyed)
+    {}
+
+    ~Tracked()
+    {
+        *destroyed_ = true;
+    }
+
+    int value_;
+    bool* destroyed_;
+};
+
+static size_t cleansedBytes = 0;
+
+static void recordCleanse(void* p, size_t n) noexcept
+{
+    cleansedBytes = n;
+    burn(p, n);
+}
+
+template <typename T>
+using recording_allocator = sanitizing_allocator_base<T, std::allocator, &recordCleanse>;
+
+
+TEST(SecureUniquePtrTest, MakeSecureShouldForwardArguments)
+{
+    bool destroyed = false;
+    auto ptr = make_secure<Tracked>(42, &destroyed);
+
+    EXPECT_EQ(ptr->value_, 42);
+    EXPECT_FALSE(destroyed);
+}
+
+TEST(SecureUniquePtrTest, ResetShouldDestroyObject)
+{
+    bool destroyed = false;
+    auto ptr = make_secure<Tracked>(42, &destroyed);
+
+    ptr.reset();
+    EXPECT_TRUE(destroyed);
+}
+
+TEST(SecureUniquePtrTest, DeleterShouldWipeWholeObject)
+{
+    cleansedBytes = 0;
+    auto ptr = make_secure<KeySchedule, recording_allocator<KeySchedule>>();
+    std::fill(std::begin(ptr->rk), std::end(ptr->rk), 0xdeadbeef);
+
+    ptr.reset();
+    EXPECT_EQ(cleansedBytes, sizeof(KeySchedule));
+}
+
+TEST(SecureUniquePtrTest, DeleterShouldNotIncreaseSizeOfPointer)
+{
+    EXPECT_EQ(sizeof(secure_unique_ptr<KeySchedule>), sizeof(KeySchedule*));
+    EXPECT_EQ(sizeof(secure_unique_ptr<KeySchedule, pooled_sanitizing_allocator<KeySchedule>>), sizeof(KeySchedule*));
+}
+
+TEST(SecureUniquePtrTest, PooledAllocatorShouldReuseReleasedBlocks)
+{
+    using Allocator = pooled_sanitizing_allocator<uint64_t>;
+
+    auto first = make_secure<uint64_t, Allocator>(0x0123456789abcdef);
+    uint64_t* ptr = first.get();
+    first.reset();
+
+    auto second = make_secure<uint64_t, Allocator>(uint64_t(1));
+    EXPECT_EQ(second.get(), ptr);
+    EXPECT_EQ(*second, 1u);
+}
+
+TEST(SecureUniquePtrTest, PooledAllocatorShouldServeLargeObjects)
+{
+    auto ptr = make_secure<KeySchedule, pooled_sanitizing_allocator<KeySchedule>>();
+    ptr->rk[59] = 7;
+
+    EXPECT_EQ(ptr->rk[59], 7u);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <thread>
+
+#include <cpp_sc/shared_secure_buffer.h>
+#include <cpp_sc/basic_string_secure.h>
+#include <cpp_sc/vector_secure.h>
+
+static const char* _16SymbolsString = "0123456789abcdef";
+
+
+TEST(SharedSecureBufferTest, ShouldTakeOwnershipByMove)
+{
+    string_secure str = _16SymbolsString;
+    const char* ptr = str.data();
+
+    shared_secure_buffer<string_secure> shared(std::move(str));
+
+    EXPECT_TRUE(str.empty());
+    EXPECT_EQ(shared.data(), ptr);
+    EXPECT_EQ(shared.get(), _16SymbolsString);
+}
+
+TEST(SharedSecureBufferTest, CopyingHandleShouldShareContents)
+{
+    shared_secure_buffer<vector_secure<uint8_t>> shared(vector_secure<uint8_t>{ 1, 2, 3, 4 });
+    auto other = shared;
+
+    EXPECT_EQ(other.data(), shared.data());
+    EXPECT_EQ(shared.use_count(), 2);
+}
+
+TEST(SharedSecureBufferTest, CopyShouldMakeIndependentContainer)
+{
+    shared_secure_buffer<vector_secure<uint8_t>> shared(vector_secure<uint8_t>{ 1, 2, 3, 4 });
+
+    vector_secure<uint8_t> copied = shared.copy();
+    copied[0] = 9;
+
+    EXPECT_NE(copied.data(), shared.data());
+    EXPECT_EQ(shared[0], 1);
+}
+
+TEST(SharedSecureBufferTest, DefaultConstructedShouldBeEmpty)
+{
+    shared_secure_buffer<string_secure> shared;
+
+    EXPECT_FALSE(shared);
+    EXPECT_TRUE(shared.empty());
+    EXPECT_EQ(shared.data(), nullptr);
+    EXPECT_EQ(shared.begin(), shared.end());
+    EXPECT_TRUE(shared.copy().empty());
+}
+
+TEST(SharedSecureBufferTest, MovedFromShouldBeEmpty)
+{
+    shared_secure_buffer<vector_secure<uint8_t>> shared(vector_secure<uint8_t>{ 1, 2, 3, 4 });
+    auto other = std::move(shared);
+
+    EXPECT_FALSE(shared);
+    EXPECT_EQ(shared.begin(), shared.end());
+    EXPECT_EQ(other.use_count(), 1);
+}
+
+TEST(SharedSecureBufferTest, HandlesShouldBeSharedAcrossThreads)
+{
+    shared_secure_buffer<string_secure> shared{ string_secure(_16SymbolsString) };
+
+    std::vector<std::thread> threads;
+    std::atomic<int> matches = 0;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([handle = shared, &matches] {
+            if (handle.get() == _16SymbolsString)
+                ++matches;
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    EXPECT_EQ(matches.load(), 8);
+    EXPECT_EQ(shared.use_count(), 1);
+}
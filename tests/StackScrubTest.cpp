@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdint>
+
+#include <cpp_sc/scoped_stack_scrub.h>
+
+#if defined(_MSC_VER)
+#define TEST_NOINLINE __declspec(noinline)
+#else
+#define TEST_NOINLINE __attribute__((noinline))
+#endif
+
+static constexpr uint8_t SECRET_BYTE = 0xa5;
+
+// The top of the secret's frame is reused by the scrubbing helper's own frame
+// (return address, saved registers) rather than zeroed
+static constexpr size_t HELPER_FRAME = 128;
+
+// Leaves a secret in a stack buffer of the given size and returns where it was
+template <size_t Size>
+TEST_NOINLINE static uintptr_t leaveSecretOnStack()
+{
+    volatile uint8_t secret[Size];
+    for (size_t i = 0; i < Size; ++i)
+        secret[i] = SECRET_BYTE;
+    return reinterpret_cast<uintptr_t>(&secret[0]);
+}
+
+TEST_NOINLINE static size_t countSecretBytes(uintptr_t address, size_t size)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < size; ++i)
+        count += reinterpret_cast<volatile uint8_t*>(address)[i] == SECRET_BYTE;
+    return count;
+}
+
+
+TEST(StackScrubTest, ScopeExitShouldWipeUsedStack)
+{
+    uintptr_t secret;
+    {
+        scoped_stack_scrub scrub;
+        secret = leaveSecretOnStack<2048>();
+    }
+
+    EXPECT_EQ(countSecretBytes(secret, 2048 - HELPER_FRAME), 0u);
+}
+
+TEST(StackScrubTest, ScrubShouldReportReachedDepth)
+{
+    scoped_stack_scrub scrub(8192);
+    leaveSecretOnStack<3000>();
+    size_t wiped = scrub.scrub();
+
+    EXPECT_GE(wiped, 3000u);
+    EXPECT_LT(wiped, 8192u);
+}
+
+TEST(StackScrubTest, ShallowCallShouldWipeLittle)
+{
+    scoped_stack_scrub scrub(8192);
+    leaveSecretOnStack<16>();
+    size_t wiped = scrub.scrub();
+
+    EXPECT_LT(wiped, 2048u);
+    EXPECT_EQ(scrub.scrub(), 0u);
+}
+
+TEST(StackScrubTest, BurnStackShouldWipeFixedDepth)
+{
+    uintptr_t secret = leaveSecretOnStack<1024>();
+    burn_stack(4096);
+
+    EXPECT_EQ(countSecretBytes(secret, 1024 - HELPER_FRAME), 0u);
+}
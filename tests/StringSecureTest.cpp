@@ -1,7 +1,13 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <iterator>
+#include <ranges>
+#include <sstream>
+#include <vector>
+
 #include <cpp_sc/basic_string_secure.h>
+#include <cpp_sc/vector_secure.h>
 
 static const char* _15SymbolsString = "0123456789abcde";
 static const char* _16SymbolsString = "0123456789abcdef";
@@ -90,6 +96,46 @@ TEST_F(StaticSanitizeTest, ShouldNotCall_Sanitize_For16SymbolsString)
     EXPECT_CALL(*mock, calledFromSanitize(_, _)).Times(0);
 }
 
+TEST_F(StaticSanitizeTest, ShouldCall_Sanitize_ForShortStringPoppedFromStdVector)
+{
+    using secure_string = basic_string_secure<char, SanitizingAllocatorChild<char>>;
+    std::vector<secure_string, sanitizing_allocator<secure_string>> vec;
+    vec.reserve(2);
+    vec.emplace_back(_15SymbolsString);
+
+    EXPECT_CALL(*mock, calledFromSanitize(_, _)).Times(1);
+    vec.pop_back();
+    testing::Mock::VerifyAndClearExpectations(mock);
+}
+
+TEST(StringSecureTest, AssignOnSecureVectorShouldWipeReplacedShortStrings)
+{
+    vector_secure<string_secure> vec;
+    vec.reserve(2);
+    vec.emplace_back("SECRETPASSWORD1");
+    vec.emplace_back("SECRETPASSWORD2");
+    const char* second = vec[1].data();
+
+    string_secure replacement[] = { string_secure("x") };
+    vec.assign(std::make_move_iterator(std::begin(replacement)), std::make_move_iterator(std::end(replacement)));
+
+    for (size_t i = 0; i < 15; ++i)
+        ASSERT_EQ(second[i], 0) << "char " << i << " is not wiped";
+}
+
+TEST(StringSecureTest, PopBackFromSecureVectorShouldStillWipeInlineBuffer)
+{
+    vector_secure<string_secure> vec;
+    vec.reserve(2);
+    vec.emplace_back("password");
+    const char* inline_buffer = vec[0].data();
+
+    vec.pop_back();
+
+    for (size_t i = 0; i < 8; ++i)
+        ASSERT_EQ(inline_buffer[i], 0) << "char " << i << " is not wiped";
+}
+
 
 class StringSecureConstructorTest : public testing::Test {
 protected:
@@ -179,7 +225,7 @@ TEST_F(StringSecureConstructorTest, MoveAssignmentOperatorShouldMakeMovedStringE
 
 TEST(StringSecureTest, MoveAssignmentOperatorIntoExistingObjectShouldMakeMovedStringEmpty)
 {
-    string_secure str1;
+    string_secure str1("OLD-SECRET-KEY-0123456789");
     string_secure str2(_16SymbolsString);
 
     char* ptr1;
@@ -189,6 +235,7 @@ TEST(StringSecureTest, MoveAssignmentOperatorIntoExistingObjectShouldMakeMovedSt
     ptr1 = str1.data();
 
     EXPECT_EQ(ptr1, ptr2);
+    EXPECT_TRUE(str2.empty());
 }
 
 TEST_F(StringSecureConstructorTest, MethodCopyShouldCopiesDataCorrectly)
@@ -228,6 +275,43 @@ TEST_F(StringSecureConstructorTest, MethodCopyByIteratorsShouldCopiesDataCorrect
     EXPECT_EQ(str_, copied);
 }
 
+TEST_F(StringSecureConstructorTest, MethodCopyRangeShouldCopiesDataCorrectly)
+{
+    str_ = _16SymbolsString;
+    string_secure copied = string_secure::copy_range(std::string_view(str_));
+
+    EXPECT_NE(str_.data(), copied.data());
+    EXPECT_EQ(str_, copied);
+}
+
+TEST(StringSecureTest, CopyRangeShouldAllocateExactlyForForwardRange)
+{
+    std::string_view source = "0123456789abcdef0123456789abcdef0123456789abcdef0123456789";
+    auto digits = source | std::views::filter([](char c) { return c >= '0' && c <= '9'; });
+    string_secure str = string_secure::copy_range(digits);
+
+    EXPECT_EQ(str, "0123456789012345678901234567890123456789");
+    EXPECT_EQ(str.capacity(), 40u);
+}
+
+TEST(StringSecureTest, CopyRangeShouldUseSizeHintForInputRange)
+{
+    std::istringstream in("0 1 2 3 4 5 6 7 8 9 a b c d e f 0 1 2 3 4 5 6 7 8 9 a b c d e f 0 1 2 3 4 5 6 7");
+    string_secure str = string_secure::copy_range(std::views::istream<char>(in), 40);
+
+    EXPECT_EQ(str, "0123456789abcdef0123456789abcdef01234567");
+    EXPECT_EQ(str.capacity(), 40u);
+}
+
+#ifdef __cpp_lib_containers_ranges
+TEST(StringSecureTest, RangesToShouldBuildString)
+{
+    auto str = std::string_view(_16SymbolsString) | std::views::reverse | std::ranges::to<string_secure>();
+
+    EXPECT_EQ(str, "fedcba9876543210");
+}
+#endif // __cpp_lib_containers_ranges
+
 TEST_F(StringSecureConstructorTest, MethodCopyFromPosShouldCopiesDataCorrectly)
 {
     str_ = "0123456789";
@@ -243,3 +327,114 @@ TEST_F(StringSecureConstructorTest, MethodCopySomeSymbolsFromPosShouldCopiesData
 
     EXPECT_EQ(copied, "23456");
 }
+
+TEST(StringSecureTest, VectorOfSecureStringsShouldKeepContentsAcrossGrowth)
+{
+    vector_secure<string_secure> vec;
+    for (int i = 0; i < 200; ++i)
+        vec.push_back(i % 2 ? string_secure(_15SymbolsString) : string_secure(_16SymbolsString));
+
+    for (int i = 0; i < 200; ++i) {
+        const string_secure& str = vec[i];
+        ASSERT_EQ(str, i % 2 ? _15SymbolsString : _16SymbolsString);
+    }
+
+    vec[1] += "0123456789";
+    EXPECT_EQ(vec[1].size(), 25u);
+}
+
+TEST_F(StringSecureConstructorTest, AssignSecureShouldReuseCapacity)
+{
+    string_secure src = "short secret, but not in sso";
+    string_secure dst(64, 'x');
+    const char* ptr = dst.data();
+
+    dst.assign_secure(src);
+
+    EXPECT_EQ(dst.data(), ptr);
+    EXPECT_EQ(dst, src);
+}
+
+TEST_F(StringSecureConstructorTest, AssignSecureShouldWipeDroppedTail)
+{
+    string_secure dst(64, 'x');
+    const char* ptr = dst.data();
+
+    dst.assign_secure("0123456789abcdef0123456789");
+
+    EXPECT_EQ(ptr[26], '\0');
+    EXPECT_TRUE(std::all_of(ptr + 27, ptr + 65, [](char c) { return c == 0; }));
+}
+
+TEST_F(StringSecureConstructorTest, CopyIntoShouldCopyIntoShorterDestination)
+{
+    string_secure dst = "x";
+
+    copy_into(dst, str_);
+
+    EXPECT_EQ(dst, str_);
+}
+
+TEST_F(StringSecureConstructorTest, AssignmentFromCharPointerShouldReuseCapacity)
+{
+    const char* ptr = str_.data();
+
+    str_ = "0123456789abcde";
+
+    EXPECT_EQ(str_.data(), ptr);
+    EXPECT_EQ(str_, "0123456789abcde");
+}
+
+
+class StringSecureShrinkTest : public testing::Test {
+protected:
+    void SetUp()
+    {
+        str_.assign(32, 'x');
+        ptr_ = str_.data();
+    }
+
+    testing::AssertionResult WipedFrom(size_t pos)
+    {
+        for (size_t i = pos; i <= 32; ++i) {
+            if (ptr_[i] != 0)
+                return testing::AssertionFailure() << "char " << i << " is not wiped";
+        }
+        return testing::AssertionSuccess();
+    }
+
+    string_secure str_;
+    const char* ptr_ = nullptr;
+};
+
+TEST_F(StringSecureShrinkTest, ResizeShouldWipeDroppedCharacters)
+{
+    str_.resize(20);
+    EXPECT_TRUE(WipedFrom(20));
+    EXPECT_EQ(str_.size(), 20u);
+}
+
+TEST_F(StringSecureShrinkTest, EraseShouldWipeVacatedCharacters)
+{
+    str_.erase(4, 8);
+    EXPECT_TRUE(WipedFrom(24));
+
+    str_.erase(str_.begin());
+    EXPECT_TRUE(WipedFrom(23));
+
+    str_.erase(str_.begin(), str_.begin() + 3);
+    EXPECT_TRUE(WipedFrom(20));
+}
+
+TEST_F(StringSecureShrinkTest, PopBackShouldWipeLastCharacter)
+{
+    str_.pop_back();
+    EXPECT_TRUE(WipedFrom(31));
+}
+
+TEST_F(StringSecureShrinkTest, ClearShouldWipeAllCharacters)
+{
+    str_.clear();
+    EXPECT_TRUE(WipedFrom(0));
+    EXPECT_EQ(str_.data(), ptr_);
+}
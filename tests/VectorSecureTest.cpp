@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <cstring>
+#include <ranges>
+#include <sstream>
+
 #include <cpp_sc/vector_secure.h>
 
 using Type = uint32_t;
@@ -139,3 +143,211 @@ TEST_F(VectorSecureConstructorsTest, MethodCopyByIteratorsShouldCopiesDataCorrec
     EXPECT_NE(ptr1, ptr2);
     EXPECT_TRUE(VectorsEqual(vec_, copied));
 }
+
+TEST_F(VectorSecureConstructorsTest, MethodCopyRangeShouldCopiesDataCorrectly)
+{
+    vector_secure<uint8_t> copied = vector_secure<uint8_t>::copy_range(vec_);
+
+    EXPECT_NE(vec_.data(), copied.data());
+    EXPECT_TRUE(VectorsEqual(vec_, copied));
+}
+
+TEST(VectorSecureRangeTests, CopyRangeShouldAllocateExactlyForForwardRange)
+{
+    auto odd = std::views::iota(0, 200) | std::views::filter([](int i) { return i % 2; });
+    vector_secure<Type> vec = vector_secure<Type>::copy_range(odd);
+
+    ASSERT_EQ(vec.size(), 100u);
+    EXPECT_EQ(vec.capacity(), 100u);
+    EXPECT_EQ(vec.front(), 1u);
+    EXPECT_EQ(vec.back(), 199u);
+}
+
+TEST(VectorSecureRangeTests, CopyRangeShouldUseSizeHintForInputRange)
+{
+    std::istringstream in("1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20");
+    vector_secure<Type> vec = vector_secure<Type>::copy_range(std::views::istream<Type>(in), 20);
+
+    ASSERT_EQ(vec.size(), 20u);
+    EXPECT_EQ(vec.capacity(), 20u);
+    EXPECT_EQ(vec.back(), 20u);
+}
+
+#ifdef __cpp_lib_containers_ranges
+TEST(VectorSecureRangeTests, RangesToShouldBuildVector)
+{
+    auto vec = std::views::iota(0u, 10u) | std::ranges::to<vector_secure<Type>>();
+
+    ASSERT_EQ(vec.size(), 10u);
+    EXPECT_EQ(vec.capacity(), 10u);
+    EXPECT_EQ(vec[9], 9u);
+}
+#endif // __cpp_lib_containers_ranges
+
+
+TEST(VectorSecureGrowthTests, GrowthShouldKeepInnerBuffersInPlace)
+{
+    vector_secure<vector_secure<int>> vec;
+    vec.push_back(vector_secure<int>{ 1, 2, 3 });
+    const int* inner = vec[0].data();
+
+    for (int i = 0; i < 100; ++i)
+        vec.push_back(vector_secure<int>{ i });
+
+    EXPECT_EQ(vec[0].data(), inner);
+    EXPECT_EQ(vec[0][2], 3);
+    EXPECT_EQ(vec[100][0], 99);
+}
+
+TEST(VectorSecureGrowthTests, EmplaceBackFromOwnElementShouldSurviveGrowth)
+{
+    vector_secure<vector_secure<int>> vec;
+    vec.push_back(vector_secure<int>{ 7, 8 });
+    ASSERT_EQ(vec.size(), vec.capacity());
+
+    vec.push_back(std::move(vec[0]));
+
+    EXPECT_TRUE(vec[0].empty());
+    EXPECT_EQ(vec[1][1], 8);
+}
+
+
+TEST_F(VectorSecureConstructorsTest, AssignSecureShouldReuseCapacity)
+{
+    vector_secure<uint8_t> dst(size_t(32), uint8_t(0xff));
+    const uint8_t* ptr = dst.data();
+
+    dst.assign_secure(vec_);
+
+    EXPECT_EQ(dst.data(), ptr);
+    EXPECT_TRUE(VectorsEqual(vec_, dst));
+}
+
+TEST_F(VectorSecureConstructorsTest, AssignSecureShouldWipeDroppedTail)
+{
+    vector_secure<uint8_t> dst(size_t(32), uint8_t(0xff));
+    const uint8_t* ptr = dst.data();
+
+    dst.assign_secure(vec_);
+
+    EXPECT_TRUE(std::all_of(ptr + vec_.size(), ptr + 32, [](uint8_t b) { return b == 0; }));
+}
+
+TEST_F(VectorSecureConstructorsTest, CopyIntoShouldCopyIntoSmallerDestination)
+{
+    vector_secure<uint8_t> dst = { 1 };
+
+    copy_into(dst, vec_);
+
+    EXPECT_TRUE(VectorsEqual(vec_, dst));
+}
+
+
+class VectorSecureShrinkTest : public testing::Test {
+protected:
+    void SetUp()
+    {
+        vec_.assign(16, 0xff);
+        ptr_ = vec_.data();
+    }
+
+    testing::AssertionResult WipedFrom(size_t pos)
+    {
+        for (size_t i = pos; i < 16; ++i) {
+            if (ptr_[i] != 0)
+                return testing::AssertionFailure() << "byte " << i << " is not wiped";
+        }
+        return testing::AssertionSuccess();
+    }
+
+    vector_secure<uint8_t> vec_;
+    const uint8_t* ptr_ = nullptr;
+};
+
+TEST_F(VectorSecureShrinkTest, ResizeShouldWipeDroppedElements)
+{
+    vec_.resize(4);
+    EXPECT_TRUE(WipedFrom(4));
+    EXPECT_EQ(vec_[3], 0xff);
+}
+
+TEST_F(VectorSecureShrinkTest, EraseShouldWipeVacatedElements)
+{
+    vec_.erase(vec_.begin() + 2, vec_.begin() + 6);
+    EXPECT_TRUE(WipedFrom(12));
+
+    vec_.erase(vec_.begin());
+    EXPECT_TRUE(WipedFrom(11));
+}
+
+TEST_F(VectorSecureShrinkTest, PopBackShouldWipeLastElement)
+{
+    vec_.pop_back();
+    EXPECT_TRUE(WipedFrom(15));
+}
+
+TEST_F(VectorSecureShrinkTest, ClearShouldWipeAllElements)
+{
+    vec_.clear();
+    EXPECT_TRUE(WipedFrom(0));
+    EXPECT_EQ(vec_.data(), ptr_);
+}
+
+
+// Claims to return zeroed blocks but fills them with a marker, which shows
+// whether the container wrote the value-initialized elements itself.
+template <typename T>
+struct MarkedZeroedAllocator : std::allocator<T> {
+    static constexpr bool zeroed_allocations = true;
+
+    MarkedZeroedAllocator() = default;
+
+    template <typename U>
+    MarkedZeroedAllocator(const MarkedZeroedAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n)
+    {
+        T* p = std::allocator<T>::allocate(n);
+        std::memset(static_cast<void*>(p), 0xab, n * sizeof(T));
+        return p;
+    }
+};
+
+template <typename T>
+using marked_sanitizing_allocator = sanitizing_allocator_base<T, MarkedZeroedAllocator>;
+
+TEST(VectorSecureZeroedTests, CountConstructorShouldSkipFillForZeroedAllocator)
+{
+    vector_secure<uint8_t, marked_sanitizing_allocator<uint8_t>> vec(64);
+
+    EXPECT_EQ(vec.size(), 64u);
+    EXPECT_EQ(vec[63], 0xab);
+}
+
+TEST(VectorSecureZeroedTests, GrowingResizeShouldSkipFillForZeroedAllocator)
+{
+    vector_secure<uint32_t, marked_sanitizing_allocator<uint32_t>> vec(4);
+    vec[0] = 1;
+
+    vec.resize(100);
+
+    EXPECT_EQ(vec[0], 1u);
+    EXPECT_EQ(vec[99], 0xabababab);
+}
+
+TEST(VectorSecureZeroedTests, ResizeWithinCapacityShouldStillValueInitialize)
+{
+    vector_secure<uint8_t, marked_sanitizing_allocator<uint8_t>> vec(64);
+    vec.resize(8);
+
+    vec.resize(64);
+
+    EXPECT_EQ(vec[63], 0);
+}
+
+TEST(VectorSecureZeroedTests, CountConstructorShouldFillForDefaultAllocator)
+{
+    vector_secure<uint8_t> vec(size_t(4096));
+
+    EXPECT_TRUE(std::all_of(vec.begin(), vec.end(), [](uint8_t b) { return b == 0; }));
+}
@@ -0,0 +1,16 @@
+#ifndef TEST_UTILS_H
+#define TEST_UTILS_H
+
+#include <algorithm>
+#include <cstddef>
+
+/**
+ * True when all \p size bytes at \p ptr equal \p value.
+ */
+inline bool allBytesAre(const void* ptr, size_t size, unsigned char value)
+{
+    auto* bytes = static_cast<const unsigned char*>(ptr);
+    return std::all_of(bytes, bytes + size, [value](unsigned char b) { return b == value; });
+}
+
+#endif // TEST_UTILS_H